@@ -0,0 +1,237 @@
+"""
+bench_pipeline.py
+
+Reproducible timings of the verification pipeline on fixed reference workloads, with a correctness check of
+N_needed against stored baselines
+
+Functions:
+    - time_call(fn, repeat): Best and median wall time of repeated calls
+    - bench_stages(...): Time compute_lambda, compute_kronecker, logarithmic_derivative and compute_zeros per d set and K
+    - bench_verify(...): Time base_case_verify on the baseline discriminants and compare N_used with N_needed
+    - compare(current, previous, tolerance): Entries of a previous report that got slower by more than tolerance
+    - main(): Command-line entry point
+
+Constants:
+    - D_SETS    — Fixed discriminant sets: small |d| and |d| ~ 10^6, negative and positive
+    - K_VALUES  — Truncations benchmarked for the χ / Λ / L'/L stages
+    - BASELINE  — Stored (d, eta, K, eps, N_needed) rows, taken from the eta = 6 sweep in results/eta6_1M.csv
+
+Usage:
+    python benchmarks/bench_pipeline.py --config-file local_config.json --output bench.json
+    python benchmarks/bench_pipeline.py --config-file local_config.json --compare bench.json
+
+Notes
+-----
+- The report is one JSON document: run metadata, one entry per (stage, d set, K, backend) with min / median
+  seconds per call, and the correctness rows; keep one per commit to track the native kernels over time
+- compute_zeros and base_case_verify need lcalc; without a config file only the χ / Λ / L'/L stages run
+- Zeros are never served from a cache here, so lcalc time is measured on every run
+- Exit status 1 if any N_used differs from its baseline or any stage regressed beyond --tolerance
+"""
+
+import argparse
+import csv
+import json
+import platform
+import statistics
+import sys
+import tempfile
+import time
+from pathlib import Path
+from typing import Callable, Dict, List, Optional, Tuple
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+
+from grhverify.base_case import base_case_verify, logarithmic_derivative
+from grhverify.native import AVAILABLE as NATIVE_AVAILABLE, resolve_backend
+from grhverify.utils import metrics as run_metrics
+from grhverify.utils.generate_zeros import compute_zeros
+from grhverify.utils.kronecker_symbol import compute_kronecker
+from grhverify.utils.von_mangoldt import compute_lambda
+
+D_SETS: Dict[str, Tuple[int, ...]] = {
+    "small_negative": (-3, -4, -7, -8, -11, -15, -19, -20, -23, -24),
+    "small_positive": (5, 8, 12, 13, 17, 21, 24, 28, 29),
+    "large_negative": (-999995, -999991, -999988, -999987),
+    "large_positive": (999985, 999989, 999993, 999996, 999997),
+}
+K_VALUES = (10**4, 10**5)
+ZERO_COUNT = 50                 # Zeros per d requested in the compute_zeros stage
+BASELINE = Path(__file__).resolve().parent / "baselines" / "n_needed_eta6.csv"
+
+# =========================== TIMING ===========================
+
+def time_call(fn: Callable[[], object], repeat: int) -> Tuple[float, float]:
+    """
+    Purpose:
+        Time repeated calls of fn
+    Input:
+        fn (Callable): Workload without arguments
+        repeat (int): Number of calls
+    Return:
+        (min seconds, median seconds)
+    """
+    samples = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        fn()
+        samples.append(time.perf_counter() - start)
+    return min(samples), statistics.median(samples)
+
+
+def _entry(stage: str, d_set: str, K: int, backend: str, calls: int, timing: Tuple[float, float]) -> Dict[str, object]:
+    # One report row; per-call times are averaged over the d of the set
+    return {"stage": stage, "d_set": d_set, "K": K, "backend": backend, "calls": calls,
+            "min_s": timing[0] / calls, "median_s": timing[1] / calls}
+
+
+def bench_stages(backend: str, repeat: int, lcalc_path: Optional[Path]) -> List[Dict[str, object]]:
+    """
+    Purpose:
+        Time each pipeline stage on every d set and K
+    Input:
+        backend (str): χ / L'/L backend
+        repeat (int): Calls per measurement
+        lcalc_path (Optional[Path]): lcalc executable; None skips the compute_zeros stage
+    Return:
+        List of report entries
+    """
+    entries: List[Dict[str, object]] = []
+    for K in K_VALUES:
+        entries.append(_entry("compute_lambda", "-", K, "-", 1, time_call(lambda: compute_lambda(K), repeat)))
+        lam = compute_lambda(K)
+
+        for name, ds in D_SETS.items():
+            entries.append(_entry("compute_kronecker", name, K, backend, len(ds),
+                                  time_call(lambda: [compute_kronecker(d, K, backend=backend) for d in ds], repeat)))
+
+            chis = [compute_kronecker(d, K, backend=backend) for d in ds]
+            entries.append(_entry("logarithmic_derivative", name, K, backend, len(ds),
+                                  time_call(lambda: [logarithmic_derivative(-1, K, chi, lam, backend=backend) for chi in chis], repeat)))
+
+    # Zeros do not depend on K
+    if lcalc_path is not None:
+        for name, ds in D_SETS.items():
+            entries.append(_entry("compute_zeros", name, 0, "-", len(ds),
+                                  time_call(lambda: [compute_zeros(d, ZERO_COUNT, lcalc_path) for d in ds], repeat)))
+    return entries
+
+
+def bench_verify(backend: str, lcalc_path: Path) -> Tuple[List[Dict[str, object]], List[Dict[str, object]]]:
+    """
+    Purpose:
+        Run base_case_verify on every baseline row, timing it and checking N_used against N_needed
+    Input:
+        backend (str): Verification backend
+        lcalc_path (Path): lcalc executable
+    Return:
+        (per-d timing entries with their stage metrics, correctness rows)
+    """
+    timings: List[Dict[str, object]] = []
+    checks: List[Dict[str, object]] = []
+    with open(BASELINE, newline="") as f:
+        rows = list(csv.DictReader(f))
+
+    with tempfile.TemporaryDirectory() as scratch:
+        scratch = Path(scratch)
+        for row in rows:
+            d, eta, K, eps = int(row["d"]), float(row["eta"]), int(row["K"]), float(row["eps"])
+            expected = int(row["N_needed"])
+
+            metrics = run_metrics.begin()
+            start = time.perf_counter()
+            success, _, N_used = base_case_verify(d, K, eta, eps, lcalc_path, scratch / "data", scratch / "errors.log", backend=backend)
+            elapsed = time.perf_counter() - start
+
+            timings.append({"stage": "base_case_verify", "d": d, "K": K, "backend": backend, "seconds": elapsed, **metrics.snapshot()})
+            checks.append({"d": d, "eta": eta, "K": K, "eps": eps, "expected": expected, "N_used": N_used,
+                           "success": success, "ok": N_used == expected})
+    return timings, checks
+
+# =========================== REGRESSIONS ===========================
+
+def _key(entry: Dict[str, object]) -> Tuple:
+    return entry["stage"], entry.get("d_set", entry.get("d")), entry["K"], entry["backend"]
+
+
+def compare(current: Dict[str, object], previous: Dict[str, object], tolerance: float) -> List[str]:
+    """
+    Purpose:
+        Find the entries that got slower than tolerance x their value in a previous report
+    Input:
+        current, previous (Dict): Reports produced by this script
+        tolerance (float): Allowed slowdown factor
+    Return:
+        Human-readable regression lines (empty if none)
+    """
+    before = {_key(entry): entry for entry in previous["timings"]}
+    regressions = []
+    for entry in current["timings"]:
+        old = before.get(_key(entry))
+        if old is None:
+            continue
+        field = "min_s" if "min_s" in entry else "seconds"
+        if entry[field] > tolerance * old[field]:
+            regressions.append(f"{' '.join(str(part) for part in _key(entry))}: {old[field]:.3e} s -> {entry[field]:.3e} s")
+    return regressions
+
+# =========================== ENTRY ===========================
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Benchmark the GRH verification pipeline")
+    parser.add_argument("-config", "--config-file", type=str, default=None, help="JSON config with lcalc_path (omit to skip the lcalc stages)")
+    parser.add_argument("--backend", type=str, default="auto", help="Backend for χ, L'/L and base_case_verify")
+    parser.add_argument("--repeat", type=int, default=5, help="Calls per stage measurement")
+    parser.add_argument("--output", type=str, default=None, help="Write the JSON report here (default: stdout)")
+    parser.add_argument("--compare", type=str, default=None, help="Previous JSON report to check for regressions")
+    parser.add_argument("--tolerance", type=float, default=1.25, help="Allowed slowdown factor against --compare")
+    args = parser.parse_args()
+
+    lcalc_path = None
+    if args.config_file is not None:
+        lcalc_path = Path(json.loads(Path(args.config_file).expanduser().read_text())["lcalc_path"]).expanduser()
+
+    # Read the previous report first: --output may overwrite it
+    previous = json.loads(Path(args.compare).read_text()) if args.compare is not None else None
+
+    # χ and L'/L have no arb variant: the certified backend is benchmarked on the full verification only
+    stage_backend = "auto" if args.backend == "arb" else args.backend
+    timings = bench_stages(stage_backend, args.repeat, lcalc_path)
+    checks: List[Dict[str, object]] = []
+    if lcalc_path is not None:
+        verify_timings, checks = bench_verify(args.backend, lcalc_path)
+        timings += verify_timings
+
+    report = {
+        "meta": {
+            "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S"),
+            "python": platform.python_version(),
+            "machine": platform.machine(),
+            "native": NATIVE_AVAILABLE,
+            "backend": args.backend if args.backend == "arb" else resolve_backend(args.backend),
+            "repeat": args.repeat,
+        },
+        "timings": timings,
+        "correctness": checks,
+    }
+    text = json.dumps(report, indent=1)
+    if args.output is not None:
+        Path(args.output).write_text(text + "\n")
+    else:
+        print(text)
+
+    # Failures go to stderr so stdout stays valid JSON
+    status = 0
+    for check in checks:
+        if not check["ok"]:
+            print(f"N_needed mismatch for d = {check['d']}: expected {check['expected']}, got {check['N_used']}", file=sys.stderr)
+            status = 1
+    if previous is not None:
+        for line in compare(report, previous, args.tolerance):
+            print(f"Regression: {line}", file=sys.stderr)
+            status = 1
+    sys.exit(status)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,40 +4,71 @@ driver.py
 Command-line entry point for verifying the Generalized Riemann Hypothesis (GRH) for 
 quadratic Dirichlet L-functions using first logarithmic derivative 
 
-This script parses user arguments, filters to fundamental discriminants, chooses a 
+This script parses user arguments, splits the range into blocks (optionally one shard of them),
+and hands them to grhverify.scheduler, which filters to fundamental discriminants, chooses a 
 verification height η (either user-provided or based on the first zero), and then
-calls base_case_verify for each d. Results are logged to stdout and appended to a CSV summary
+calls base_case_verify for each d on one or more worker processes. Results are logged to stdout
+and written in batches to a CSV summary by a single buffered results sink
 
 Arguments:
     -d, --discriminant      Single discriminant to test (mutually exclusive with d-min/d-max)
     --d-min, --d-max        Inclusive range of discriminants to test
     -eta, --height          Optional window half-width η
                             If not provided, set to (first zero ordinate + 2*ε)
-    -k, --power             Which logarithmic derivative to use (base case k = 1)
+    --targets               Several heights in one pass: ETA[:EPS],... (ETA "auto" = first zero + 2ε; k = 1 only)
+                            One summary row per target and d, all from one RHS and one zero stream
+    -k, --power             Which logarithmic derivative to use (base case k = 1, or even k >= 2)
+    --delta                 k >= 2: evaluate at s = 1 - delta (default: smallest |delta| whose window holds eta)
     -K, --upper-limit       Truncation parameter K for χ/Λ arrays (default 1e5)
+    --K-auto                Choose K from log max|d| (grhverify.base_case.truncation_for) instead of -K, for large conductors
+    --K-start               Adaptive truncation: first K tried per d, grown x4 towards -K only while that saves zeros
     -eps, --epsilon         Half-width epsilon for zero intervals (default 1e-6)
+    --backend               L'/L series backend: auto | native | mpmath | arb (default auto)
+    --jobs                  Number of worker processes (default 1)
+    --block-size            Discriminants per scheduling block (default 256)
+    --shard                 Run only shard i of n, e.g. 0/4, to split a sweep across nodes
+    --resume                Skip discriminants already in summary.csv or the checkpoint journal
+    --screen                RHS-only pass first: write results/screen.csv, record the d needing no zeros at once,
+                            and run the rest block by block in decreasing predicted cost (fixed -eta, k = 1)
+    --prefetch              Fetch zeros for up to this many upcoming d in a background thread per worker (default 0 = off)
+    --batch-zeros           Range mode: prefetch this many zeros per d with one lcalc run per d-interval (default 0 = off)
+    --batch-width           Width of the d-interval covered by one batched lcalc run (default 1000)
     -config, --config-file  Path to JSON config containing {"lcalc_path": "..."}
     -data, --data-dir       Directory for caching zeros, intervals, χ, Λ (default "data")
+    --no-zero-cache         Recompute zeros even if data/zero_cache (or earlier outputs) already hold them
+    --data-format           store (one binary file per d-block, default) or text (per-d text files)
     -output, --output-dir   Directory for output and logs (default "results")
+    --metrics               Also write per-d stage timings and counters to results/metrics.csv
+    --summary-format        csv (default), csv.gz (appended gzip members) or parquet (needs pyarrow)
+    --flush-rows            Buffered result rows written per batch (default 1024)
+    --flush-seconds         Longest time a finished row waits before being written (default 5)
 
 Usage:
     python driver.py --d-min -1000 --d-max 1000
 
 Outputs:
-    results/summary.csv     CSV with columns [d, eta, N_needed]
+    results/summary.csv     CSV with columns [d, eta, N_needed] (summary.csv.gz / summary_parquet/ with --summary-format)
     results/errors.log      Any runtime errors per discriminant
-    data/...                Computed values of zeros, intervals, χ, Λ for each d
+    results/screen.csv      With --screen: d, rhs, margin rhs - 2 iota(eta), predicted zero count
+    results/metrics.csv     With --metrics: d, per-stage seconds (t_kronecker ... t_write) and counters per d
+    results/checkpoint.bin  Binary journal of completed discriminants (int64 each), read by --resume
+    data/von_mangoldt.bin   Dense Λ table, written once and memory-mapped (shared) by later runs and workers
+    data/store/*.grh        Zeros and outcomes per d-block (binary, memory-mappable; see grhverify.utils.data_store)
 """
 
-import csv
 import json
 import argparse
-from typing import List
+from typing import List, Set, Tuple
 from pathlib import Path
 
-from grhverify.utils.discriminant import is_fundamental_discriminant
-from grhverify.utils.generate_zeros import compute_zeros
-from grhverify.base_case import base_case_verify
+from grhverify.scheduler import SweepConfig, d_blocks, shard_blocks, parse_shard, parse_targets, run_sweep
+from grhverify.utils.checkpoint import CheckpointJournal
+from grhverify.utils.results_sink import ResultsSink, SUMMARY_FORMATS, FLUSH_ROWS, FLUSH_SECONDS, completed_from_outputs, raise_on_signals
+from grhverify.base_case import VERIFY_BACKENDS, truncation_for
+from grhverify.certified import AVAILABLE as CERTIFIED_AVAILABLE
+from grhverify.utils.metrics import MetricsReport
+from grhverify.utils.von_mangoldt import lambda_table
+from grhverify.screening import screen_blocks, cost_order, write_screen, screen_report
 
 # =========================== BASE CASE ENTRY ===========================
 
@@ -55,31 +86,81 @@ def main() -> None:
     
     # Verification parameters
     parser.add_argument("-eta", "--height", type=float, help="Width of the window to verify the RH")
+    parser.add_argument("--targets", type=str, default=None, help="Several (eta, eps) targets per pass: ETA[:EPS],... with ETA a number or auto")
     parser.add_argument("-k", "--power", type=int, default=1, help="K-th logarithmic derivative L'/L used in verification")
+    parser.add_argument("--delta", type=int, default=None, help="Higher power: evaluation point s = 1 - delta (negative integer)")
     parser.add_argument("-K", "--upper-limit", type=int, default=10**5, help="Upper limit for lambda/kronecker array")
+    parser.add_argument("--K-auto", action="store_true", help="Pick K from log max|d| so the L'/L tail bound stays below REMAINDER_SHARE / log|d|")
+    parser.add_argument("--K-start", type=int, default=None, help="Adaptive truncation: start each d at this K and extend towards -K only when needed")
     parser.add_argument("-eps", "--epsilon", type=float, default=1e-6, help="Half-width for the zero intervals")
+    parser.add_argument("--screen", action="store_true", help="Screen the range on the RHS alone first and schedule lcalc work by predicted cost")
+    parser.add_argument("--prefetch", type=int, default=0, help="Discriminants whose zeros a background thread fetches ahead of the verification (0 = off)")
+    parser.add_argument("--batch-zeros", type=int, default=0, help="Zeros per d prefetched by batched lcalc runs in range mode (0 = off)")
+    parser.add_argument("--batch-width", type=int, default=1000, help="Width of the d-interval per batched lcalc run")
+    parser.add_argument("--jobs", type=int, default=1, help="Number of worker processes pulling d-blocks from a shared queue")
+    parser.add_argument("--block-size", type=int, default=256, help="Discriminants per scheduling block")
+    parser.add_argument("--shard", type=str, help="Only run shard i of n (round-robin over blocks), e.g. 0/4")
+    parser.add_argument("--resume", action="store_true", help="Skip discriminants already recorded in summary.csv / checkpoint.bin")
+    parser.add_argument("--backend", type=str, default="auto", choices=VERIFY_BACKENDS, help="L'/L series backend (native kernel, mpmath reference, or certified arb)")
     
     # Paths for tools & I/O
     # parser.add_argument("-config", "--config-file", type=str, default="example_config.json", help="Path to config.json with lcalc_path")
     parser.add_argument("-config", "--config-file", type=str, default="local_config.json", help="Path to config.json with lcalc_path")
     parser.add_argument("-data", "--data-dir", type=str, default="data", help="Directory for data/input/cache files")
+    parser.add_argument("--no-zero-cache", action="store_true", help="Always recompute zeros instead of reusing data/zero_cache")
+    parser.add_argument("--data-format", type=str, default="store", choices=("store", "text"), help="Binary block store or legacy per-d text files")
     parser.add_argument("-output", "--output-dir", type=str, default="results", help="Directory for output file")
+    parser.add_argument("--metrics", action="store_true", help="Write per-d stage timings and counters to metrics.csv")
+    parser.add_argument("--summary-format", type=str, default="csv", choices=SUMMARY_FORMATS, help="Summary backend: plain CSV, gzip-compressed CSV or Parquet parts")
+    parser.add_argument("--flush-rows", type=int, default=FLUSH_ROWS, help="Result rows buffered before a batched write")
+    parser.add_argument("--flush-seconds", type=float, default=FLUSH_SECONDS, help="Longest time a finished row stays buffered")
     
     args = parser.parse_args()
 
+    # Base case (k = 1) or an even higher power
+    k = args.power
+    if not (k == 1 or (k % 2 == 0 and k >= 2)):
+        raise ValueError("k must be either 1 or an even integer greater than or equal to 2")
+    if k != 1 and (args.backend == "arb" or args.K_start is not None):
+        raise ValueError("--backend arb and --K-start are only available for the base case k = 1")
+    if args.backend == "arb" and not CERTIFIED_AVAILABLE:
+        raise ValueError("--backend arb needs python-flint (pip install python-flint)")
+
+    # Multi-target pass: replaces -eta, base case on the native / mpmath backends only
+    targets = None
+    if args.targets is not None:
+        if args.height is not None:
+            raise ValueError("Cannot provide both -eta and --targets")
+        if k != 1 or args.backend == "arb" or args.K_start is not None:
+            raise ValueError("--targets is only available for the base case k = 1 without --backend arb or --K-start")
+        targets = parse_targets(args.targets, args.epsilon)
+    if args.screen and (args.height is None or k != 1 or args.backend == "arb" or args.K_start is not None):
+        raise ValueError("--screen needs a fixed -eta and the base case k = 1 without --backend arb or --K-start")
+
     # Validate discriminant input
     if args.discriminant is not None:
         # Single-d mode cannot mix with range
         if args.d_min or args.d_max:
             raise ValueError("Cannot provide both --discriminant and --d-min/d-max")
-        d_list: List[int] = [args.discriminant]
+        blocks: List[Tuple[int, int]] = [(args.discriminant, args.discriminant)]
     elif (args.d_min is not None) and (args.d_max is not None):
         if args.d_min > args.d_max:
             raise ValueError("--d-min must be less than or equal to --d-max")
-        d_list = list(range(args.d_min, args.d_max + 1))
+        blocks = list(d_blocks(args.d_min, args.d_max, args.block_size))
     else:
         raise ValueError("Must provide either --discriminant or both --d-min and --d-max")
 
+    # Keep only this node's share of the blocks
+    if args.shard is not None:
+        shard_index, shard_count = parse_shard(args.shard)
+        blocks = list(shard_blocks(blocks, shard_index, shard_count))
+
+    # Truncation from the largest conductor of the run
+    K = args.upper_limit
+    if args.K_auto:
+        K = truncation_for(max((max(abs(lo), abs(hi)) for lo, hi in blocks), default=1))
+        print(f"K = {K} from log max|d|")
+
     # Load the config file (lcalc path)
     config_path = Path(args.config_file).expanduser()
     try:
@@ -94,49 +175,57 @@ def main() -> None:
     data_dir   = Path(args.data_dir).expanduser()
     data_dir.mkdir(parents=True, exist_ok=True)
 
-    # Open summary CSV for append
-    summary_path = output_dir / "summary.csv"
-    new_file = not summary_path.exists()
-    summary_fh = summary_path.open("a", newline="")
-    writer = csv.writer(summary_fh)
-    if new_file:
-        # write header on first run
-        writer.writerow(["d", "eta", "N_needed"])
-
-    # Direct the RH verification based on the power k 
-    k = args.power
-    if k == 1:
-        # Direct to base case verification
-        for d in d_list:
-            # Skip non-fundamental discriminants silently
-            if not is_fundamental_discriminant(d):
-                continue
-
-            # Determine height η: user input or based on first zero + padding
-            eta: float
-            if args.height is not None:
-                eta = args.height
-            else:
-                try:
-                    first_zero = float(compute_zeros(d, 1, lcalc_path)[0])
-                    eta = first_zero + 2 * args.epsilon     # Padding so that η is larger than the upper interval bound
-                except Exception as err:
-                    raise RuntimeError(f"Fail to compute the first zero ordinate to use at height eta for GRH verification")
-
-            # Call the base case verification function
-            success, eta, N_used = base_case_verify(
-                d=d,
-                K=args.upper_limit,
-                eta=eta,
-                eps=args.epsilon,
-                lcalc_path=lcalc_path,
-                data_dir=data_dir,
-                log_path=log_path
-            )
-
-            # Human‐readable console output
-            writer.writerow([d, eta, N_used])
-            summary_fh.flush()
+    # Resume: everything already in the summary or the journal is skipped before any lcalc or χ work
+    journal = CheckpointJournal(output_dir / "checkpoint.bin")
+    completed: Set[int] = set()
+    if args.resume:
+        completed = completed_from_outputs(output_dir) | journal.load()
+        print(f"Resuming: {len(completed)} discriminants already completed")
+
+    # One buffered writer for summary, metrics, errors and journal; SIGTERM unwinds into its final flush
+    sink = ResultsSink(output_dir, args.summary_format, args.flush_rows, args.flush_seconds, metrics=args.metrics, journal=journal)
+    raise_on_signals()
+
+    # Aggregate of the per-d metrics, printed at the end of every run
+    report = MetricsReport()
+
+    # Parameters shared by every discriminant (and every worker process)
+    config = SweepConfig(
+        K=K,
+        eps=args.epsilon,
+        lcalc_path=lcalc_path,
+        data_dir=data_dir,
+        log_path=log_path,
+        eta=args.height,
+        backend=args.backend,
+        batch_zeros=args.batch_zeros,
+        batch_width=args.batch_width,
+        data_format=args.data_format,
+        zero_cache=not args.no_zero_cache,
+        K_start=args.K_start,
+        k=k,
+        delta=args.delta,
+        targets=targets,
+        prefetch=max(0, args.prefetch),
+    )
+
+    # Base case or higher power per config.k; Λ is computed (or memory-mapped) once and shared
+    with sink:
+        # Screening: d with 2 iota(eta) > rhs are done without lcalc; the other blocks go out costliest first
+        if args.screen:
+            rows = screen_blocks(blocks, config.K, args.height, lambda_table(config.K, data_dir), args.backend, completed)
+            write_screen(output_dir / "screen.csv", rows)
+            print("\n".join(screen_report(rows)))
+            free = [row.d for row in rows if row.predicted == 0]
+            for d in free:
+                sink.add(d, args.height, 0)
+            completed = completed | set(free)
+            blocks = cost_order(blocks, rows)
+
+        for d, success, eta, N_used, metrics, error in run_sweep(blocks, config, jobs=args.jobs, completed=completed):
+            # Buffered; the journal is updated only after the batch holding this row is written
+            sink.add(d, eta, N_used, metrics, error)
+            report.add(metrics)
 
             # Print to console
             if success:
@@ -144,12 +233,10 @@ def main() -> None:
             else:
                 print(f"Fail to verify the RH with discriminant d = {d} up to height eta = {eta}")
 
-    elif (k % 2 == 0 and k >= 2): 
-        # Later implementation for higher power
-        pass
+    journal.close()
 
-    else:
-        raise ValueError("k must be either 1 or an even integer greater than or equal to 2")
+    # Aggregate stage timings and counters of this run
+    print("\n".join(report.lines()))
 
 
 if __name__ == "__main__":
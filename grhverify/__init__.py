@@ -8,15 +8,20 @@ Public re-exports:
     /* utils */
     - compute_zeros
     - compute_intervals
+    - ZeroStream
     - compute_lambda
+    - lambda_table
     - compute_kronecker
 
     /* base_case.py */
     - iota
     - logarithmic_derivative
+    - logarithmic_derivative_batch
     - base_case_verify
+    - inverse_verify
 
     /* higher_power.py */
+    - higher_power_verify
 
 """
 
@@ -37,21 +42,28 @@ __all__: list[str]                    # declared later (after imports)
 # Public API re-exports
 # ----------------------------------------------------------------------
 from .utils.generate_zeros import compute_zeros, compute_intervals
-from .utils.von_mangoldt import compute_lambda
+from .utils.zero_stream import ZeroStream
+from .utils.von_mangoldt import compute_lambda, lambda_table
 from .utils.kronecker_symbol import compute_kronecker
 
-from .base_case import iota, logarithmic_derivative, base_case_verify
-# from .higher_power import logarithmic_derivative, iota
+from .base_case import iota, logarithmic_derivative, logarithmic_derivative_batch, base_case_verify, inverse_verify
+from .higher_power import higher_power_verify
 
 __all__ = [
     "compute_zeros",
     "compute_intervals",
+    "ZeroStream",
     "compute_lambda",
+    "lambda_table",
     "compute_kronecker",
 
     "iota",
     "logarithmic_derivative",
+    "logarithmic_derivative_batch",
     "base_case_verify",
+    "inverse_verify",
+
+    "higher_power_verify",
     
     "__version__",
 ]
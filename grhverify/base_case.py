@@ -5,30 +5,61 @@ Perform the base case verification (k = 1) of GRH for a single quadratic Dirichl
 
 Functions:
     - iota(eta): Compute the maximum missing-zeros contribution up to height η
+    - iota_lower(etas, policy, backend): Certified lower bounds of iota over a vector of heights in one native call
+    - max_height(bound): Supremum of the η with iota(η) > bound (closed-form inverse of iota)
     - logarithmic_derivative(...): Finite approximation of the logarithmic derivative L'/L(1 - delta, χ_d)
+                                   (native double-double kernel or mpmath reference path)
+    - truncation_for(d, share): Power-of-two K whose L'/L tail bound is at most share / log|d|
+    - partial_series(...): Terms k_start..K of the L'/L series, for extending a truncated sum
+    - refine_truncation(...): Grow K for one d only while a larger K could still reduce the zeros needed
+    - prime_power_weights(...): d-independent weights Λ(k)/k^(1 - delta) over the prime powers k <= K
+    - logarithmic_derivative_batch(...): L'/L(1 - delta, χ_d) for many d sharing one set of weights
+    - predicted_zero_count(d, gap): Number of zeros expected to close the gap rhs - 2 iota(eta), from N(T, χ_d)
+    - zero_prefix_lower(zeros, eps, out): Rigorous lower bounds of the zero-contribution prefix sums C(Z)_1..C(Z)_N
+    - first_crossing(stream, eps, lhs0, rhs, chunk): Smallest N with lhs0 + C(Z)_N > rhs, by binary search
+    - first_crossings(stream, eps, lhs0s, rhs, chunk): The same for several lhs0 sharing one eps and one prefix array
+    - crossing_index(prefix, lhs0, rhs): Smallest i with lhs0 + prefix[i] > rhs over non-decreasing prefix bounds
+    - rhs_constant(d): Constant RHS term 1/2 log(|d| e^2 / 4π e^γ) (d < 0) or 1/2 log(|d| / π e^γ) (d > 0)
     - base_case_verify(...): Test flow for specific discriminant d. Record the number of zeros needed to verify the GRH up to height η
+    - base_case_verify_targets(...): N_needed for several (η, ε) targets from one RHS and one zero stream
+    - max_verified_eta(d, zeros, eps, rhs, backend): Largest η verified by a fixed list of zeros
+    - inverse_verify(ds, K, eps, data_dir, ...): max_verified_eta for many d from their cached zeros, without lcalc
 
 Constants:
     - mp.dps — mpmath precision
     - EULER  — Euler-Mascheroni constant
     - PI     — π
     - E      — e (base of natural logarithm)
+    - VERIFY_BACKENDS — Backends accepted by base_case_verify (those of grhverify.native plus "arb")
+    - SYMMETRY_TOL — Tolerance of the Type 2 (symmetric interval) test
+    - ZERO_MARGIN, ZERO_SLACK — Safety margin on the predicted zero count (relative, absolute)
+    - REMAINDER_SHARE, K_AUTO_RANGE — Tail budget and K range of truncation_for
+    - PRECISION_POLICIES — Policies of the compiled iota / zero-term evaluator: "double", "dd" (double-double), "ball"
 
 Usage:
     success, eta, N_used = base_case_verify(
-        d, K, eta, eps, lcalc_path, data_dir, log_path, chunk=10
+        d, K, eta, eps, lcalc_path, data_dir, log_path, chunk=None, backend="auto"
     )
+    [(d, eta_max, N_used), ...] = inverse_verify(ds, K, eps, data_dir, N=None)
 """
 
-from typing import Tuple, List
+import bisect
+from typing import Tuple, List, Sequence, Optional
 from pathlib import Path
 
 import numpy as np 
 import mpmath as mp
 
-from .utils.generate_zeros import compute_zeros, compute_intervals, write_zeros, write_intervals
-from .utils.von_mangoldt import compute_lambda, write_lambda
-from .utils.kronecker_symbol import compute_kronecker, write_kronecker
+from .utils.generate_zeros import write_zeros, write_intervals
+from .utils.zero_stream import ZeroStream
+from .utils.zero_cache import ZeroCache
+from .utils.data_store import StoreWriter, INDEX_DTYPE
+from .utils.arena import ScratchArena
+from .utils import metrics as run_metrics
+from .utils.von_mangoldt import lambda_table
+from .utils.kronecker_symbol import compute_kronecker, kronecker_matrix, write_kronecker
+from .native import _native, resolve_backend, BACKENDS
+from .certified import certified_gap, certified_verify
 
 # =============================== CONSTANTS ===============================
 
@@ -36,6 +67,14 @@ mp.dps = 50             # Working precision
 EULER  = mp.euler       # Euler-Mascheroni constant
 PI     = mp.pi          # π
 E      = mp.e           # Base of natural logarithm 
+VERIFY_BACKENDS = BACKENDS + ("arb",)
+SYMMETRY_TOL = 1e-12    # |gamma_minus + gamma_plus| below this: Type 2 interval
+ZERO_MARGIN  = 1.25     # Predicted zero count is inflated by 25% ...
+ZERO_SLACK   = 4        # ... plus a few zeros, so one lcalc request usually suffices
+ZERO_CAP     = 4096     # Upper limit on a single predicted request (growth continues beyond it)
+REMAINDER_SHARE = 1e-4  # truncation_for: tail bound kept below REMAINDER_SHARE / log|d| ...
+K_AUTO_RANGE = (1 << 14, 1 << 24)   # ... with K a power of two in this range
+PRECISION_POLICIES = ("double", "dd", "ball")
 
 # =========================== UTILITY FUNCTIONS ===========================
 
@@ -56,7 +95,52 @@ def iota(eta: mp.mpf) -> mp.mpf:
     # Take the minimum and return as an mp.mpf
     return mp.mpf(min(term1, term2))
 
-def logarithmic_derivative(delta: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray, remainder_bound: bool = True) -> mp.mpf:
+
+def iota_lower(etas: Sequence[float], policy: str = "dd", backend: str = "auto") -> List[mp.mpf]:
+    """
+    Purpose:
+        Lower bounds of iota(η) for every η of a grid, from one call of the compiled evaluator (native/contrib.hpp)
+        The lower end of its enclosure replaces the mpmath value, so 2 iota(η) + C(Z)_N > rhs is still proved;
+        with "dd" the enclosure is within 32u² ≈ 4e-31 relative of the exact value
+    Input:
+        etas (Sequence[float]): Heights η
+        policy (str): One of PRECISION_POLICIES
+        backend (str): "auto" | "native" | "mpmath" (iota itself, per η)
+    Return:
+        List of mp.mpf, one per η
+    """
+    if policy not in PRECISION_POLICIES:
+        raise ValueError(f"policy must be one of {PRECISION_POLICIES}, got {policy!r}")
+    if resolve_backend(backend) != "native":
+        return [iota(mp.mpf(eta)) for eta in etas]
+    eta_arr = np.ascontiguousarray(etas, dtype=np.float64)
+    hi, lo, rad = (np.empty_like(eta_arr) for _ in range(3))
+    _native.iota_batch(eta_arr, policy, hi, lo, rad)
+    return [mp.mpf(float(h)) + mp.mpf(float(l)) - mp.mpf(float(r)) for h, l, r in zip(hi, lo, rad)]
+
+
+def max_height(bound: mp.mpf) -> Optional[mp.mpf]:
+    """
+    Purpose:
+        Invert iota: both branches are decreasing in η, so iota(η) > bound exactly for η below the smaller of
+        the two crossing heights, each a root of a polynomial in x = η²
+    Input:
+        bound (mp.mpf): Value iota(η) has to exceed
+    Return:
+        Supremum of those η (mp.inf if bound <= 0), or None if even iota(0) = 4/3 does not exceed bound
+    """
+    g = mp.mpf(bound)
+    if g <= 0:
+        return mp.inf
+    if g >= mp.mpf(4) / 3:
+        return None
+
+    # 12 / (9 + 4x) > g  and  1 / (1 + x) + 2 / (4 + x) > g  <=>  g x² + (5g - 3) x + (4g - 6) < 0
+    x_term2 = (12 / g - 9) / 4
+    x_term1 = (3 - 5 * g + mp.sqrt(9 * g * g - 6 * g + 9)) / (2 * g)
+    return mp.sqrt(min(x_term1, x_term2))
+
+def logarithmic_derivative(delta: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray, remainder_bound: bool = True, backend: str = "auto") -> mp.mpf:
     """
     Purpose: 
         Compute the partial-series approximation of L'/L at s = 1 - delta (delta < 0)
@@ -67,6 +151,10 @@ def logarithmic_derivative(delta: int, K: int, chi_arr: np.ndarray, lambda_arr:
         chi_arr    - NumPy array of χ(k) for k=0..K (χ(0) unused)
         lambda_arr - NumPy array of Λ(k) for k=0..K (Λ(0) = 0)
         remainder_bound - whether to add the analytic tail bound
+        backend    - "native": compiled double-double kernel; the returned value is the certified
+                                upper end of the truncated sum (sum + rounding error bound)
+                     "mpmath": reference term-by-term evaluation at mp.dps, for cross-checking
+                     "auto":   native if the extension is built, else mpmath
     Return:
         mp.mpf approximation to L'/L(s) at s = 1 - delta
     """
@@ -77,23 +165,347 @@ def logarithmic_derivative(delta: int, K: int, chi_arr: np.ndarray, lambda_arr:
         raise ValueError("K must be an integer greater than or equal to 18")
 
     # Sum the explicit series
+    total = partial_series(delta, 1, K, chi_arr, lambda_arr, backend=backend)
+
+    # Analytic upper bound of remainder term contribution
+    if remainder_bound:
+        total += remainder_term(delta, K)
+
+    return total
+
+def partial_series(delta: int, k_start: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray, backend: str = "auto") -> mp.mpf:
+    """
+    Purpose:
+        Terms k_start <= k <= K of the L'/L series, -Σ Λ(k)χ(k)/k^(1 - delta), so a truncated sum can be
+        extended to a larger K without recomputing its head
+    Input:
+        delta      - Negative integer
+        k_start    - First index summed (>= 1)
+        K          - Last index summed
+        chi_arr    - χ(k) for k=0..K
+        lambda_arr - Λ(k) for k=0..K
+        backend    - "native" (certified upper end) | "mpmath" | "auto", as in logarithmic_derivative
+    Return:
+        mp.mpf; upper ends of consecutive pieces add up to an upper end of the whole sum
+    """
+    if resolve_backend(backend) == "native":
+        # Native kernel: hi + lo is within err of the exact sum Σ Λ(k)χ(k)/k^(1 - delta)
+        chi_arr    = np.ascontiguousarray(chi_arr, dtype=np.int8)
+        lambda_arr = np.ascontiguousarray(lambda_arr, dtype=np.float64)
+        hi, lo, err = _native.dense_series(chi_arr, lambda_arr, K, 1 - delta, k_start)
+
+        # The series enters with a minus sign; round the result upwards for the RHS
+        return -(mp.mpf(hi) + mp.mpf(lo)) + mp.mpf(err)
+
+    # Only prime powers coprime to d contribute: visit the nonzero terms of the (sparse) Λχ product
+    terms = np.asarray(lambda_arr[k_start:K + 1]) * np.asarray(chi_arr[k_start:K + 1])
     total = mp.mpf("0")
-    for k in range(1, K + 1):
+    for k in (np.flatnonzero(terms) + k_start).tolist():
         # Compute the general lambda value lambda_L
-        lambda_L = mp.mpf(lambda_arr[k] * chi_arr[k])
+        lambda_L = mp.mpf(float(terms[k - k_start]))
 
         # Add the contribution of the k-th term to the sum
         total -= lambda_L / mp.power(k, 1 - delta)
+    return total
 
-    # Analytic upper bound of remainder term contribution
-    if remainder_bound:
-        total += (mp.power(K, delta) / delta) * (2.85 * (2 * delta - 1) / mp.log(K) - 1)
+def remainder_term(delta: int, K: int) -> mp.mpf:
+    """
+    Purpose:
+        Analytic upper bound of the tail of the L'/L series beyond K
+    Input:
+        delta - Negative integer
+        K     - Truncation parameter
+    Return:
+        mp.mpf value of the remainder bound
+    """
+    return (mp.power(K, delta) / delta) * (2.85 * (2 * delta - 1) / mp.log(K) - 1)
 
-    return total
+def truncation_for(d: int, share: float = REMAINDER_SHARE, K_range: Tuple[int, int] = K_AUTO_RANGE) -> int:
+    """
+    Purpose:
+        Choose K from the size of the conductor: the smallest power of two in K_range whose tail bound
+        remainder_term(-1, K) is at most share / log|d|
+        The zeros get denser like log|d| / 2π, so one unit of RHS costs about log|d| times more zeros at large |d|;
+        scaling the tail budget by 1 / log|d| keeps the zeros spent on the remainder bound roughly constant
+    Input:
+        d (int): Discriminant (the largest |d| of a sweep)
+        share (float): Tail budget times log|d|
+        K_range (Tuple[int, int]): Smallest and largest K returned
+    Return:
+        Truncation parameter K
+    """
+    budget = mp.mpf(share) / mp.log(max(abs(d), 3))
+    K, K_max = K_range
+    while K < K_max and remainder_term(-1, K) > budget:
+        K *= 2
+    return K
+
+def prime_power_weights(K: int, lambda_arr: np.ndarray, delta: int = -1) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Purpose:
+        Precompute the weights Λ(k)/k^(1 - delta), which do not depend on d, over the prime powers k <= K only
+    Input:
+        K          - Truncation parameter
+        lambda_arr - NumPy array of Λ(k) for k=0..K
+        delta      - Negative integer
+    Return:
+        (k_idx, w, w_err): prime powers (int64), rounded weights, and bounds on their rounding error
+    """
+    if _native is None:
+        raise RuntimeError("prime_power_weights requires the native extension")
+
+    # Λ vanishes off the prime powers, so only ~K / log K entries survive
+    k_idx = np.flatnonzero(np.asarray(lambda_arr[:K + 1])).astype(np.int64)
+    lam   = np.ascontiguousarray(lambda_arr[k_idx], dtype=np.float64)
+    w     = np.empty_like(lam)
+    w_err = np.empty_like(lam)
+    _native.power_weights(k_idx, lam, 1 - delta, w, w_err)
+    return k_idx, w, w_err
+
+def logarithmic_derivative_batch(ds: Sequence[int], K: int, delta: int = -1, remainder_bound: bool = True, lambda_arr: np.ndarray | None = None, backend: str = "auto", block: int = 256) -> List[mp.mpf]:
+    """
+    Purpose:
+        Evaluate logarithmic_derivative for many discriminants at once
+        The weights Λ(k)/k^(1 - delta) are shared; each d only contributes the signs χ_d(k) at the
+        prime powers, laid out as a (prime powers x discriminants) int8 matrix per block
+    Input:
+        ds         - Discriminants
+        K          - Truncation parameter (>= 18)
+        delta      - Negative integer
+        remainder_bound - whether to add the analytic tail bound
+        lambda_arr - Optional precomputed Λ(k) for k=0..K (default: the process-wide lambda_table(K))
+        backend    - "auto" | "native" | "mpmath" (mpmath falls back to one logarithmic_derivative per d)
+        block      - Number of discriminants per χ matrix
+    Return:
+        List of mp.mpf values, one per d, equal to logarithmic_derivative(delta, K, χ_d, Λ, ...)
+    """
+    # Input validation
+    if not (isinstance(delta, int) and delta < 0):
+        raise ValueError("delta must be a negative integer ")
+    if not (isinstance(K, int) and K >= 18):
+        raise ValueError("K must be an integer greater than or equal to 18")
+    if lambda_arr is None:
+        lambda_arr = lambda_table(K)
+    ds = [int(d) for d in ds]
+
+    # Reference path: independent evaluation per discriminant
+    if resolve_backend(backend) == "mpmath":
+        return [
+            logarithmic_derivative(delta, K, compute_kronecker(d, K, backend="mpmath"), lambda_arr, remainder_bound, backend="mpmath")
+            for d in ds
+        ]
+
+    # Shared weights and remainder, computed once for the whole batch
+    k_idx, w, w_err = prime_power_weights(K, lambda_arr, delta)
+    tail = remainder_term(delta, K) if remainder_bound else mp.mpf("0")
+
+    results: List[mp.mpf] = []
+    for b0 in range(0, len(ds), block):
+        block_ds = ds[b0:b0 + block]
+
+        # χ matrix: row j holds χ_d(k_j) for every d in the block, evaluated at the prime powers only
+        chi_mat = kronecker_matrix(block_ds, k_idx)
+
+        hi  = np.empty(len(block_ds))
+        lo  = np.empty(len(block_ds))
+        err = np.empty(len(block_ds))
+        _native.sparse_series_batch(chi_mat, w, w_err, hi, lo, err)
+
+        # Same sign convention and upward rounding as logarithmic_derivative(backend="native")
+        for h, l, e in zip(hi, lo, err):
+            results.append(-(mp.mpf(float(h)) + mp.mpf(float(l))) + mp.mpf(float(e)) + tail)
+
+    return results
+
+# =========================== ZERO CONTRIBUTIONS ===========================
+
+def predicted_zero_count(d: int, gap: float) -> int:
+    """
+    Purpose:
+        Estimate how many zeros are needed before C(Z)_N = Σ 12 / (9 + 4 γ_n²) exceeds gap, replacing the zero
+        sum by an integral against the density dN⁺(t) = (1/2π) log(|d| t / 2π) dt of positive ordinates,
+        then converting the height T reached into N⁺(T) ≈ (T/2π) log(|d| T / 2πe)
+    Input:
+        d (int): Fundamental discriminant
+        gap (float): rhs - 2 iota(eta)
+    Return:
+        Predicted count including the safety margin (at least 1, at most ZERO_CAP)
+    """
+    if gap <= 0:
+        return 1
+    q = abs(d)
+
+    # Cumulative contribution of the zero density up to each height of a log-spaced grid (trapezoid rule)
+    t = np.geomspace(1e-2, 1e6, 4096)
+    f = 12.0 / (9.0 + 4.0 * t * t) * np.maximum(np.log(q * t / (2 * np.pi)), 0.0) / (2 * np.pi)
+    cumulative = np.concatenate(([0.0], np.cumsum(0.5 * (f[1:] + f[:-1]) * np.diff(t))))
+
+    # Height at which the density integral closes the gap (all zeros together may never do so)
+    pos = int(np.searchsorted(cumulative, gap))
+    if pos >= len(t):
+        return ZERO_CAP
+    T = t[pos]
+
+    count = T / (2 * np.pi) * np.log(q * T / (2 * np.pi * np.e))
+    return int(min(ZERO_CAP, max(1, np.ceil(ZERO_MARGIN * max(count, 0.0) + ZERO_SLACK))))
+
+
+def zero_prefix_lower(zeros: np.ndarray, eps: float, out: Optional[np.ndarray] = None, policy: str = "double") -> np.ndarray:
+    """
+    Purpose:
+        Lower bounds of the zero contributions C(Z)_N = Σ_{n <= N} c_n / (9 + 4 γ_n²) for every N at once
+        (c_n = 12 for Type 1, 6 for Type 2 intervals), rounded towards -inf by the native kernel
+    Input:
+        zeros (np.ndarray): Ordinates γ_1..γ_N
+        eps (float): Interval half-width
+        out (Optional[np.ndarray]): float64 buffer of len(zeros) entries to fill instead of allocating
+        policy (str): Precision policy of the terms (PRECISION_POLICIES); "double" is the historical kernel
+    Return:
+        np.ndarray out with out[N - 1] <= C(Z)_N, non-decreasing in N
+    """
+    if _native is None:
+        raise RuntimeError("zero_prefix_lower needs the native extension (pip install -e .)")
+    zeros = np.ascontiguousarray(zeros, dtype=np.float64)
+    out = np.empty_like(zeros) if out is None else out[:len(zeros)]
+    _native.zero_prefix_lower(zeros, float(eps), SYMMETRY_TOL, out, policy)
+    return out
+
+
+def first_crossing(stream: ZeroStream, eps: float, lhs0: mp.mpf, rhs: mp.mpf, chunk: int, arena: Optional[ScratchArena] = None) -> Tuple[bool, int]:
+    """
+    Purpose:
+        Find the smallest N with lhs0 + C(Z)_N > rhs, pulling zeros from the stream in geometrically growing
+        blocks and binary-searching the prefix lower bounds of each block
+    Input:
+        stream (ZeroStream): Zeros of L(s, χ_d)
+        eps (float): Interval half-width
+        lhs0 (mp.mpf): LHS before any zero, 2 iota(eta)
+        rhs (mp.mpf): RHS of the inequality
+        chunk (int): Size of the first block (e.g. predicted_zero_count); later blocks double
+        arena (Optional[ScratchArena]): Worker scratch memory holding the prefix sums
+    Return:
+        (success, N): N zeros verify the inequality, or (False, number of zeros available) if lcalc ran out
+    """
+    return first_crossings(stream, eps, [lhs0], rhs, chunk, arena)[0]
+
+
+def first_crossings(stream: ZeroStream, eps: float, lhs0s: Sequence[mp.mpf], rhs: mp.mpf, chunk: int, arena: Optional[ScratchArena] = None) -> List[Tuple[bool, int]]:
+    """
+    Purpose:
+        first_crossing for several starting values lhs0 (e.g. 2 iota(eta) of several heights) sharing eps: the
+        zeros are pulled and their prefix bounds computed once, for the target needing the most zeros
+    Input:
+        stream (ZeroStream): Zeros of L(s, χ_d)
+        eps (float): Interval half-width
+        lhs0s (Sequence[mp.mpf]): LHS before any zero, per target
+        rhs (mp.mpf): RHS of the inequality
+        chunk (int): Size of the first block; later blocks double
+        arena (Optional[ScratchArena]): Worker scratch memory holding the prefix sums
+    Return:
+        [(success, N)] in the order of lhs0s
+    """
+    count = chunk
+    while True:
+        zeros = np.asarray(stream.take(count), dtype=np.float64)
+        prefix = zero_prefix_lower(zeros, eps, arena.prefix_table(len(zeros)) if arena is not None else None)
+
+        # The smallest lhs0 needs the most zeros: once it crosses, every target does
+        if (len(zeros) and min(lhs0s) + mp.mpf(prefix[-1]) > rhs) or len(zeros) < count:
+            break
+        count *= 2
+
+    results = []
+    for lhs0 in lhs0s:
+        N = crossing_index(prefix, lhs0, rhs)
+        results.append((True, N + 1) if N < len(zeros) else (False, len(zeros)))   # False: no more zeros from lcalc
+    return results
+
+
+def crossing_index(prefix: np.ndarray, lhs0: mp.mpf, rhs: mp.mpf) -> int:
+    """
+    Purpose:
+        Smallest index i with lhs0 + prefix[i] > rhs, for non-decreasing prefix lower bounds
+    Input:
+        prefix (np.ndarray): Non-decreasing float64 prefix bounds (zero_prefix_lower and the like)
+        lhs0 (mp.mpf): LHS before any zero
+        rhs (mp.mpf): RHS of the inequality
+    Return:
+        int (len(prefix) if no prefix crosses)
+    """
+    # "lhs > rhs" flips from False to True exactly once: below the gap rhs - lhs0 rounded down it is False,
+    # above it rounded up True, and mpmath decides only in between
+    gap = float(rhs - lhs0)
+    first = int(np.searchsorted(prefix, np.nextafter(gap, -np.inf), side="right"))
+    last  = int(np.searchsorted(prefix, np.nextafter(gap, np.inf), side="right"))
+    return first + bisect.bisect_left(range(first, last), True, key=lambda i: lhs0 + mp.mpf(prefix[i]) > rhs)
+
+
+def rhs_constant(d: int) -> mp.mpf:
+    """
+    Purpose:
+        Constant term of the RHS, depending only on the sign and size of d
+    Input:
+        d (int): Fundamental discriminant
+    Return:
+        mp.mpf
+    """
+    if d < 0:
+        return mp.mpf("0.5") * mp.log((abs(d) * E**2) / (4 * PI * E**EULER))
+    return mp.mpf("0.5") * mp.log(abs(d) / (PI * E**EULER))
+
+def refine_truncation(d: int, K: int, K_cur: int, series: mp.mpf, rhs_const: mp.mpf, lhs0: mp.mpf, stream: ZeroStream, eps: float, chunk: int, lambda_arr: np.ndarray, chi_arr: np.ndarray, growth: int = 4, arena: Optional[ScratchArena] = None) -> Tuple[mp.mpf, int, np.ndarray]:
+    """
+    Purpose:
+        Adaptive truncation: starting from the partial sum up to K_cur, multiply K_cur by growth (capped at K)
+        only while a larger truncation could still lower the number of zeros needed. Whatever K' > K_cur is
+        used, the tail bound gives rhs(K') >= rhs(K_cur) - 2 R(K_cur), so once this floor needs as many zeros
+        as rhs(K_cur) itself, extending the sum cannot help
+    Input:
+        d          - Fundamental discriminant
+        K          - Largest truncation allowed
+        K_cur      - Current truncation
+        series     - partial_series(-1, 1, K_cur, ...) (native upper end)
+        rhs_const  - Constant RHS term
+        lhs0       - 2 iota(eta)
+        stream     - Zeros of L(s, χ_d)
+        eps        - Interval half-width
+        chunk      - Size of the first zero request
+        lambda_arr - Λ(k) for k=0..K
+        chi_arr    - χ_d(k) for k=0..K_cur
+        growth     - Factor by which K_cur grows per step
+        arena      - Worker scratch memory for χ_d and the prefix sums (None: allocate)
+    Return:
+        (rhs, K_used, chi_arr): RHS at the chosen truncation, the truncation, and χ_d up to it
+    """
+    while True:
+        rhs = rhs_const + series + remainder_term(-1, K_cur)
+        if K_cur >= K:
+            return rhs, K_cur, chi_arr
+
+        # Margin is wide enough: no larger K can reduce the zero count. lhs0 + C > rhs - 2R is the target
+        # lhs0 + 2R against rhs, so one first_crossings pass over one zero prefix decides both
+        at_rhs, at_floor = first_crossings(stream, eps, [lhs0, lhs0 + 2 * remainder_term(-1, K_cur)], rhs, chunk, arena)
+        if at_rhs == at_floor:
+            return rhs, K_cur, chi_arr
+
+        # Extend the sum over (K_cur, K_next] only, reusing everything computed so far
+        K_next = min(K, growth * K_cur)
+        chi_arr = compute_kronecker(d, K_next, out=arena.chi_table(K_next) if arena is not None else None)
+        series += partial_series(-1, K_cur + 1, K_next, chi_arr, lambda_arr)
+        K_cur = K_next
 
 # =========================== BASE-CASE VERIFICATION ===========================
 
-def base_case_verify(d: int, K: int, eta: float, eps: float, lcalc_path: str | Path, data_dir: str | Path, log_path: str | Path, chunk: int=10) -> Tuple[bool, int]:
+def _log_error(message: str, error_log: Optional[List[str]], log_path: str | Path) -> None:
+    # Error line of one d: to the caller's results sink if given, else appended to log_path
+    if error_log is not None:
+        error_log.append(message)
+    else:
+        with open(log_path, "a") as log:
+            log.write(message)
+
+
+def base_case_verify(d: int, K: int, eta: float, eps: float, lcalc_path: str | Path, data_dir: str | Path, log_path: str | Path, chunk: Optional[int]=None, backend: str="auto", lambda_arr: Optional[np.ndarray]=None, zero_stream: Optional[ZeroStream]=None, store: Optional[StoreWriter]=None, zero_cache: Optional[ZeroCache]=None, K_start: Optional[int]=None, log_derivative: Optional[mp.mpf]=None, error_log: Optional[List[str]]=None, arena: Optional[ScratchArena]=None, trace: Optional[List[Tuple[mp.mpf, mp.mpf, mp.mpf]]]=None) -> Tuple[bool, int]:
     """
     Purpose:
         Verify the Generalized Riemann Hypothesis for the Dirichlet character χ_d with order k = 1 (base case)
@@ -105,80 +517,140 @@ def base_case_verify(d: int, K: int, eta: float, eps: float, lcalc_path: str | P
         lcalc_path — Path to lcalc executable
         data_dir   - Directory to store the data computed
         log_path   - Path to write any error logs
-        chunk      - Number of zeros to process per internal batch
+        chunk      - Number of zeros requested up front (default: predicted_zero_count); requests then grow geometrically
+        backend    - Backend for χ and the L'/L series: "auto" | "native" | "mpmath" (Sage + mpmath reference),
+                     or "arb": the whole inequality decided in ball arithmetic (certified.py, needs python-flint)
+        lambda_arr - Precomputed Λ(k) for k=0..K shared across discriminants (default: lambda_table(K))
+        zero_stream - Optional ZeroStream for d owned by the caller (e.g. already holding the first zero)
+        store      - Optional StoreWriter for d's block; if given, results go to the binary store instead of
+                     the per-d text files under data_dir
+        zero_cache - Optional ZeroCache serving previously computed zeros (used when zero_stream is None)
+        K_start    - Adaptive truncation: start the L'/L sum at K_start and extend it towards K only while that
+                     can reduce the zeros needed (native backend; None uses K directly)
+        log_derivative - L'/L(2, χ_d) with its tail bound at truncation K, if already computed for a whole range
+                     (range_engine.py); χ_d is then only built when the text output needs it
+        error_log  - If given, error lines are appended to this list for the caller's results sink instead of
+                     opening log_path
+        arena      - Worker scratch memory (utils/arena.py) reused for χ_d and the prefix sums instead of
+                     allocating per d; reset here, so views from the previous d are overwritten
+        trace      - Debug output: if given, (γ, γ - ε, γ + ε) of every zero used is appended as mp.mpf
     Return:
         (success: bool, eta_used: float, N_used: int)
     """
+    if backend not in VERIFY_BACKENDS:
+        raise ValueError(f"backend must be one of {VERIFY_BACKENDS}, got {backend!r}")
+    certified = backend == "arb"
+    if certified:
+        backend = "auto"        # χ is exact either way; the RHS is only ever evaluated as a ball
+
+    # Adaptive truncation works on the native partial sums; other backends always use K
+    adaptive = K_start is not None and 18 <= K_start < K and not certified and resolve_backend(backend) == "native"
+    K_used   = K_start if adaptive else K
+    if adaptive or certified:
+        log_derivative = None
+
+    # Stage timers and counters of this d (reset by the caller, see utils/metrics.py)
+    metrics = run_metrics.current()
+    metrics.set("dps", mp.dps)
+    if arena is not None:
+        arena.reset()
+
     # --------- Pre-compute Kronecker and Λ arrays ---------
-    chi_arr    = compute_kronecker(d, K)
-    lambda_arr = compute_lambda(K)
+    need_chi   = log_derivative is None or store is None
+    with metrics.stage("kronecker"):
+        chi_out = arena.chi_table(K_used) if arena is not None else None
+        chi_arr = compute_kronecker(d, K_used, backend=backend, out=chi_out) if need_chi else None
+    if lambda_arr is None:
+        with metrics.stage("lambda"):
+            lambda_arr = lambda_table(K)   # Λ depends only on K: computed once per process
 
     # ------------------------- RHS -------------------------
 
-    # Compute the RHS constant based on the discriminant sign
-    if d < 0:
-        rhs_const = mp.mpf("0.5") * mp.log((abs(d) * E**2) / (4 * PI * E**EULER))
+    if certified:
+        # Certified: the RHS ball at the lowest working precision; its midpoint sizes the zero request. A failure
+        # here (python-flint missing, an arb error) is logged for this d instead of ending the sweep
+        try:
+            with metrics.stage("series"):
+                gap, rhs_arb, proven = certified_gap(d, K, eta, chi_arr, lambda_arr)
+        except Exception as err:
+            _log_error(f"Error: d = {d}, N = 0, reason = {repr(err)}\n", error_log, log_path)
+            return False, eta, 0
+
+        # 2 iota(η) > rhs certainly: no zeros needed, and no lcalc stream is opened
+        if proven:
+            return True, eta, 0
     else:
-        rhs_const = mp.mpf("0.5") * mp.log(abs(d) / (PI * E**EULER))
-
-    # Add the approximation of logarithmic derivative contribution to the RHS
-    rhs = rhs_const + logarithmic_derivative(-1, K, chi_arr, lambda_arr, remainder_bound=True)
-
-    # ----------------------- LHS -----------------------
-
-    # Initialize the LHS with the iota(eta) of the missing zeros guard
-    lhs = 2 * iota(mp.mpf(eta))
-
-    # Check if we need contribution from any zeros at all to verify the GRH up to height η
-    if lhs > rhs:
-        return True, eta, 0     # Success to verify up to height eta without any zeros needed
-
-    # Track the zeros and intervals used for verification
-    zeros_acc: List[mp.mpf] = []
-    intervals_acc: List[tuple[mp.mpf, mp.mpf]] = []
-
-    # Contribution of the zeros
+        # Compute the RHS constant based on the discriminant sign
+        rhs_const = rhs_constant(d)
+
+        # Add the approximation of logarithmic derivative contribution to the RHS
+        with metrics.stage("series"):
+            if adaptive:
+                series = partial_series(-1, 1, K_used, chi_arr, lambda_arr, backend=backend)
+                rhs = rhs_const + series + remainder_term(-1, K_used)
+            elif log_derivative is not None:
+                rhs = rhs_const + log_derivative
+            else:
+                rhs = rhs_const + logarithmic_derivative(-1, K, chi_arr, lambda_arr, remainder_bound=True, backend=backend)
+
+        # ----------------------- LHS -----------------------
+
+        # Initialize the LHS with the iota(eta) of the missing zeros guard
+        lhs = 2 * iota_lower([eta], backend=backend)[0]
+
+        # Check if we need contribution from any zeros at all to verify the GRH up to height η
+        if lhs > rhs:
+            return True, eta, 0     # Success to verify up to height eta without any zeros needed
+        gap = float(rhs - lhs)
+
+    # Ask for the predicted number of zeros at once instead of growing from a small fixed chunk
+    if chunk is None:
+        chunk = predicted_zero_count(d, gap)
+
+    # Contribution of the zeros, pulled lazily from one lcalc stream until lhs > rhs
+    stream = zero_stream if zero_stream is not None else ZeroStream(d, lcalc_path, initial=chunk, cache=zero_cache)
     N_used = 0
-    start  = 0
     try:
-        # Loop in chunks until we exceed the RHS or exhaust of zeros
-        while True:
-            # Load a new chunk of zeros and intervals 
-            need = start + chunk 
-            zeros = compute_zeros(d, need, lcalc_path)
-            intervals = compute_intervals(d, need, eps, lcalc_path, zeros=zeros)
-
-            if len(intervals) <= start:
-                break   # Exhausted zero list
-
-            # Process exactly the next 'chunk' intervals
-            intervals = intervals[start:]
-            for index, (gamma_minus, gamma_plus) in enumerate(intervals):
-                gamma_minus = mp.mpf(gamma_minus)
-                gamma_plus  = mp.mpf(gamma_plus)
-
-                # Record the zeros and intervals used
-                zeros_acc.append(mp.mpf(zeros[start + index]))
-                intervals_acc.append((gamma_minus, gamma_plus))
-
-                # Separate the contribution of the zeros by type
-                if mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=1e-12):
-                    # Type 2: symmetric [-gamma0, gamma0]
-                    gamma0 = mp.fabs(gamma_plus)
-                    lhs += 6 / (9 + 4 * gamma0 * gamma0)
-                else:
-                    # Type 1: asymmetric [gamma_minus, gamma_plus]
-                    lhs += 12 / (9 + 4 * gamma_plus * gamma_plus)
-
-                # Increment the number of used zeros
-                N_used += 1
+        # Zero fetches inside the LHS stage are charged to "lcalc"
+        with metrics.stage("lhs"):
+            # Certified: every term as an arb ball, decided at the lowest sufficient precision
+            if certified:
+                success, N_used, prec = certified_verify(d, K, eta, eps, stream, chi_arr, lambda_arr, chunk, rhs=rhs_arb)
+                metrics.set("arb_bits", prec)
+                if success:
+                    raise StopIteration     # Success
 
-                # Check if the LHS exceeds the RHS
-                if lhs > rhs:
+            # Native: all contributions of a block at once, then a binary search for the first N with lhs > rhs
+            elif resolve_backend(backend) == "native":
+                if adaptive:
+                    rhs, K_used, chi_arr = refine_truncation(d, K, K_used, series, rhs_const, lhs, stream, eps, chunk, lambda_arr, chi_arr, arena=arena)
+                success, N_used = first_crossing(stream, eps, lhs, rhs, chunk, arena)
+                if success:
                     raise StopIteration     # Success
-            
-            start += chunk 
-                    
+            else:
+                # Reference: loop over the zeros until we exceed the RHS or exhaust of zeros
+                stream.take(chunk)
+                for gamma in stream:
+                    # Interval [gamma - eps, gamma + eps] as in compute_intervals
+                    gamma_minus = mp.mpf(gamma - eps)
+                    gamma_plus  = mp.mpf(gamma + eps)
+
+                    # Separate the contribution of the zeros by type
+                    if mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=SYMMETRY_TOL):
+                        # Type 2: symmetric [-gamma0, gamma0]
+                        gamma0 = mp.fabs(gamma_plus)
+                        lhs += 6 / (9 + 4 * gamma0 * gamma0)
+                    else:
+                        # Type 1: asymmetric [gamma_minus, gamma_plus]
+                        lhs += 12 / (9 + 4 * gamma_plus * gamma_plus)
+
+                    # Increment the number of used zeros
+                    N_used += 1
+
+                    # Check if the LHS exceeds the RHS
+                    if lhs > rhs:
+                        raise StopIteration     # Success
+
         # Loop exhaust without RH verified
         success = False
 
@@ -187,29 +659,244 @@ def base_case_verify(d: int, K: int, eta: float, eps: float, lcalc_path: str | P
         success = True
 
     except Exception as err:
-        # Log the error to a file if computation fails for this d
-        with open(log_path, "a") as log:
-            log.write(f"Error: d = {d}, N = {N_used}, reason = {repr(err)}\n")
+        # Log the error (to the caller's sink, or to a file) if computation fails for this d
+        message = f"Error: d = {d}, N = {N_used}, reason = {repr(err)}\n"
+        _log_error(message, error_log, log_path)
         success = False
+
+    finally:
+        metrics.count("zeros_used", N_used)
+
+        # Debug output only: boxed mp values of the zeros and intervals used
+        if trace is not None:
+            trace.extend((mp.mpf(gamma), mp.mpf(gamma - eps), mp.mpf(gamma + eps)) for gamma in stream.known[:N_used].tolist())
+
+        # Stop lcalc as soon as no more zeros are needed (a caller-owned stream stays reusable)
+        if zero_stream is None:
+            stream.close()
     
-    # Print out the result
-    # print(f"Zeros used: {zeros_acc}")
-    # print(f"Intervals used: {intervals_acc}")
-    # print(f"Iota(eta): {iota(eta)}")
-    # print(f"Logarithmic Derivative L'/L: {logarithmic_derivative(-1, K, chi_arr, lambda_arr, remainder_bound=True)}")
-    # print(f"Constant RHS term: {rhs_const}")
-    # print(f"2 * iota(eta): {2 * iota(mp.mpf(eta))}")
-    # print(f"C(Z): {lhs - 2 * iota(mp.mpf(eta))}")
-    # print(f"RHS: {rhs}")
-    # print(f"LHS: {lhs}")
-
-    # Save zeros, intervals, lambda, and kronecker values used to .txt files
-    data_dir = Path(data_dir).expanduser().resolve()
-    data_dir.mkdir(parents=True, exist_ok=True)
-
-    write_zeros(d, [float(z) for z in zeros[:N_used]], data_dir)
-    write_intervals(d, np.asarray(intervals[:N_used], dtype=float), data_dir)
-    write_lambda(K, lambda_arr, data_dir)
-    write_kronecker(d, K, chi_arr, data_dir)
+    # Binary store: every zero computed for d plus the outcome; intervals and χ are cheap to regenerate
+    if store is not None:
+        with metrics.stage("write"):
+            zeros_all = np.asarray(stream.known, dtype=float)
+            store.add(d, zeros_all, eta, N_used, success)
+        metrics.count("bytes_written", zeros_all.nbytes + INDEX_DTYPE.itemsize)
+        return success, eta, N_used
+
+    # Save zeros, intervals, and kronecker values used to .txt files (Λ is written once per run by the driver)
+    with metrics.stage("write"):
+        data_dir = Path(data_dir).expanduser().resolve()
+        data_dir.mkdir(parents=True, exist_ok=True)
+
+        zeros_used = np.asarray(stream.known[:N_used], dtype=float)
+        written  = write_zeros(d, [float(z) for z in zeros_used], data_dir)
+        written += write_intervals(d, np.column_stack((zeros_used - eps, zeros_used + eps)), data_dir)
+        written += write_kronecker(d, K_used, chi_arr, data_dir)
+    metrics.count("bytes_written", written)
 
     return success, eta, N_used
+
+
+def base_case_verify_targets(d: int, K: int, targets: Sequence[Tuple[float, float]], lcalc_path: str | Path, data_dir: str | Path, log_path: str | Path, chunk: Optional[int]=None, backend: str="auto", lambda_arr: Optional[np.ndarray]=None, zero_stream: Optional[ZeroStream]=None, store: Optional[StoreWriter]=None, zero_cache: Optional[ZeroCache]=None, log_derivative: Optional[mp.mpf]=None, error_log: Optional[List[str]]=None, arena: Optional[ScratchArena]=None) -> List[Tuple[bool, float, float, int]]:
+    """
+    Purpose:
+        Run the base case verification for several (η, ε) targets in one pass: χ, the L'/L sum and the RHS do not
+        depend on the target, and one monotone zero stream serves every target (prefix sums are shared per ε;
+        targets differ only by 2 iota(η))
+    Input:
+        d          - Fundamental discriminant
+        K          - Truncation for chi/lambda arrays
+        targets    - Sequence of (eta, eps)
+        lcalc_path — Path to lcalc executable
+        data_dir   - Directory to store the data computed
+        log_path   - Path to write any error logs
+        chunk      - Zeros requested up front (default: predicted_zero_count for the most demanding target)
+        backend    - "auto" | "native" | "mpmath" (the certified and adaptive paths are single-target only)
+        lambda_arr - Precomputed Λ(k) for k=0..K (default: lambda_table(K))
+        zero_stream - Optional ZeroStream for d owned by the caller
+        store      - Optional StoreWriter; it records every zero computed and the outcome of the first target
+        zero_cache - Optional ZeroCache serving previously computed zeros (used when zero_stream is None)
+        log_derivative - L'/L(2, χ_d) with its tail bound at K, if already computed (range_engine.py)
+        error_log  - If given, error lines are appended here instead of opening log_path
+        arena      - Worker scratch memory for χ_d and the prefix sums, as in base_case_verify
+    Return:
+        [(success, eta, eps, N_used)] in target order
+    """
+    if backend not in BACKENDS:
+        raise ValueError(f"backend must be one of {BACKENDS}, got {backend!r}")
+    if not targets:
+        raise ValueError("targets must hold at least one (eta, eps) pair")
+    metrics = run_metrics.current()
+    metrics.set("dps", mp.dps)
+    if arena is not None:
+        arena.reset()
+
+    # --------- χ, Λ and the RHS: once for every target ---------
+    with metrics.stage("kronecker"):
+        chi_out = arena.chi_table(K) if arena is not None else None
+        chi_arr = compute_kronecker(d, K, backend=backend, out=chi_out) if (log_derivative is None or store is None) else None
+    if lambda_arr is None:
+        with metrics.stage("lambda"):
+            lambda_arr = lambda_table(K)
+    with metrics.stage("series"):
+        if log_derivative is None:
+            log_derivative = logarithmic_derivative(-1, K, chi_arr, lambda_arr, remainder_bound=True, backend=backend)
+        rhs = rhs_constant(d) + log_derivative
+
+    # ----------------------- LHS per target -----------------------
+    lhs0s = [2 * value for value in iota_lower([eta for eta, _ in targets], backend=backend)]
+    outcomes: List[Optional[Tuple[bool, int]]] = [(True, 0) if lhs0 > rhs else None for lhs0 in lhs0s]
+
+    if chunk is None:
+        chunk = predicted_zero_count(d, float(rhs - min(lhs0s)))
+    stream = zero_stream if zero_stream is not None else ZeroStream(d, lcalc_path, initial=chunk, cache=zero_cache)
+    try:
+        with metrics.stage("lhs"):
+            # Shared prefix sums per distinct eps
+            for eps in dict.fromkeys(eps for _, eps in targets):
+                pending = [i for i, (_, e) in enumerate(targets) if e == eps and outcomes[i] is None]
+                if not pending:
+                    continue
+                if resolve_backend(backend) == "native":
+                    found = first_crossings(stream, eps, [lhs0s[i] for i in pending], rhs, chunk, arena)
+                else:
+                    found = _reference_crossings(stream, eps, [lhs0s[i] for i in pending], rhs, chunk)
+                for i, outcome in zip(pending, found):
+                    outcomes[i] = outcome
+
+    except Exception as err:
+        # Log the error (to the caller's sink, or to a file); unresolved targets count as failures
+        message = f"Error: d = {d}, targets = {list(targets)}, reason = {repr(err)}\n"
+        _log_error(message, error_log, log_path)
+
+    finally:
+        if zero_stream is None:
+            stream.close()
+
+    results = [(outcome[0], eta, eps, outcome[1]) if outcome is not None else (False, eta, eps, 0) for (eta, eps), outcome in zip(targets, outcomes)]
+    metrics.count("zeros_used", max(N for *_, N in results))
+
+    # Binary store: every zero computed for d, with the outcome of the first target
+    success, eta, eps, N_used = results[0]
+    if store is not None:
+        with metrics.stage("write"):
+            zeros_all = np.asarray(stream.known, dtype=float)
+            store.add(d, zeros_all, eta, N_used, success)
+        metrics.count("bytes_written", zeros_all.nbytes + INDEX_DTYPE.itemsize)
+        return results
+
+    # Text files: the zeros needed by the most demanding target, intervals of the first target's eps
+    with metrics.stage("write"):
+        data_dir = Path(data_dir).expanduser().resolve()
+        zeros_used = np.asarray(stream.known[:max(N for *_, N in results)], dtype=float)
+        written  = write_zeros(d, [float(z) for z in zeros_used], data_dir)
+        written += write_intervals(d, np.column_stack((zeros_used - eps, zeros_used + eps)), data_dir)
+        written += write_kronecker(d, K, chi_arr, data_dir)
+    metrics.count("bytes_written", written)
+    return results
+
+
+def _reference_crossings(stream: ZeroStream, eps: float, lhs0s: Sequence[mp.mpf], rhs: mp.mpf, chunk: int) -> List[Tuple[bool, int]]:
+    # mpmath path of first_crossings: one pass over the zeros, each target resolved when its LHS exceeds the RHS
+    outcomes: List[Optional[Tuple[bool, int]]] = [None] * len(lhs0s)
+    contribution = mp.mpf("0")
+    N = 0
+    stream.take(chunk)
+    for gamma in stream:
+        gamma_minus = mp.mpf(gamma - eps)
+        gamma_plus  = mp.mpf(gamma + eps)
+        if mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=SYMMETRY_TOL):
+            contribution += 6 / (9 + 4 * gamma_plus * gamma_plus)      # Type 2
+        else:
+            contribution += 12 / (9 + 4 * gamma_plus * gamma_plus)     # Type 1
+        N += 1
+
+        for i, lhs0 in enumerate(lhs0s):
+            if outcomes[i] is None and lhs0 + contribution > rhs:
+                outcomes[i] = (True, N)
+        if all(outcome is not None for outcome in outcomes):
+            return outcomes
+    return [outcome if outcome is not None else (False, N) for outcome in outcomes]
+
+
+def max_verified_eta(d: int, zeros: np.ndarray, eps: float, rhs: mp.mpf, backend: str = "auto") -> Optional[float]:
+    """
+    Purpose:
+        Inverse mode of base_case_verify: the largest η with 2 iota(η) + C(Z)_N > rhs for the N zeros given
+    Input:
+        d (int): Fundamental discriminant
+        zeros (np.ndarray): Ordinates γ_1..γ_N already computed for d
+        eps (float): Interval half-width
+        rhs (mp.mpf): rhs_constant(d) + L'/L(2, χ_d) with its tail bound
+        backend (str): "auto" | "native" | "mpmath" (zero contributions)
+    Return:
+        Largest float η (inf if any η works) for which the inequality holds, or None if none does
+    """
+    zeros = np.asarray(zeros, dtype=np.float64)
+    if len(zeros) == 0:
+        contribution = mp.mpf("0")
+    elif resolve_backend(backend) == "native":
+        contribution = mp.mpf(float(zero_prefix_lower(zeros, eps)[-1]))
+    else:
+        contribution = mp.mpf("0")
+        for gamma in zeros:
+            gamma_minus = mp.mpf(float(gamma) - eps)
+            gamma_plus  = mp.mpf(float(gamma) + eps)
+            weight = 6 if mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=SYMMETRY_TOL) else 12
+            contribution += weight / (9 + 4 * gamma_plus * gamma_plus)
+
+    eta_sup = max_height((rhs - contribution) / 2)
+    if eta_sup is None or eta_sup == mp.inf:
+        return None if eta_sup is None else float("inf")
+
+    # The closed form is the exact supremum; the answer must pass the certified test of the forward mode
+    # (iota_lower, same policy), so bisect on the bit patterns of the positive floats below it: they are
+    # ordered like the int64 values of their bits, so this takes at most 64 evaluations
+    def holds(bits: int) -> bool:
+        eta = float(np.int64(bits).view(np.float64))
+        return 2 * iota_lower([eta], backend=backend)[0] + contribution > rhs
+
+    hi = int(np.float64(float(eta_sup)).view(np.int64))
+    if holds(hi):
+        return float(np.int64(hi).view(np.float64))
+    lo = 0
+    if not holds(lo):
+        return None
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if holds(mid):
+            lo = mid
+        else:
+            hi = mid
+    return float(np.int64(lo).view(np.float64)) if lo > 0 else None
+
+
+def inverse_verify(ds: Sequence[int], K: int, eps: float, data_dir: str | Path, N: Optional[int] = None, backend: str = "auto", lambda_arr: Optional[np.ndarray] = None, zero_cache: Optional[ZeroCache] = None) -> List[Tuple[int, Optional[float], int]]:
+    """
+    Purpose:
+        Reanalysis pass over cached zeros: for each d, the largest η the zeros already on disk verify
+        (no lcalc call; the RHS series of all d come from one logarithmic_derivative_batch)
+    Input:
+        ds         - Fundamental discriminants
+        K          - Truncation for the L'/L series
+        eps        - Interval half-width of the cached zeros
+        data_dir   - Data directory holding zero_cache/ and store/ (see ZeroCache)
+        N          - Zero budget per d: use at most the first N cached zeros (default: all of them)
+        backend    - "auto" | "native" | "mpmath"
+        lambda_arr - Precomputed Λ(k) for k=0..K (default: lambda_table(K))
+        zero_cache - ZeroCache to read from (default: ZeroCache(data_dir))
+    Return:
+        [(d, eta_max or None, N_used)] in the order of ds; N_used is the number of cached zeros used
+    """
+    if backend not in BACKENDS:
+        raise ValueError(f"backend must be one of {BACKENDS}, got {backend!r}")
+    if zero_cache is None:
+        zero_cache = ZeroCache(data_dir)
+    ds = [int(d) for d in ds]
+    series = logarithmic_derivative_batch(ds, K, lambda_arr=lambda_arr, backend=backend)
+
+    results: List[Tuple[int, Optional[float], int]] = []
+    for d, log_derivative in zip(ds, series):
+        zeros = zero_cache.known(d)[:N]
+        results.append((d, max_verified_eta(d, zeros, eps, rhs_constant(d) + log_derivative, backend), len(zeros)))
+    return results
@@ -0,0 +1,259 @@
+"""
+certified.py
+
+Certified evaluation of the base case inequality in ball arithmetic (arb, via python-flint)
+
+Functions:
+    - iota_ball(eta): iota(eta) as a ball
+    - rhs_const_ball(d): Constant RHS term 1/2 log(|d| e^2 / 4π e^γ) (d < 0) or 1/2 log(|d| / π e^γ) (d > 0)
+    - rhs_ball(d, K, chi_arr, lambda_arr): Whole RHS, rhs_const_ball plus the truncated L'/L(2, χ_d) and its tail
+    - remainder_ball(delta, K): Analytic tail bound of the L'/L series beyond K
+    - log_derivative_ball(delta, K, chi_arr, lambda_arr): Ball containing the truncated L'/L(1 - delta, χ_d) plus tail
+    - zero_term_ball(gamma_minus, gamma_plus): Type 1 / Type 2 contribution of one interval
+    - certified_gap(d, K, eta, chi_arr, lambda_arr): Midpoint of rhs - 2 iota(η) at the lowest precision (sizes the
+      zero request), the RHS ball, and whether 2 iota(η) > rhs is already certain (no zeros needed)
+    - certified_verify(d, K, eta, eps, stream, chi_arr, lambda_arr, chunk, rhs): Rigorous yes/no and the number of
+      zeros, at the lowest working precision that decides the inequality
+
+Constants:
+    - AVAILABLE   — Whether python-flint is importable
+    - PRECISIONS  — Working precisions (bits) tried in turn
+
+Notes
+-----
+- Every quantity is a ball [m ± r] containing the exact value, so lhs > rhs is only accepted when the whole
+  ball of lhs - rhs is positive; an undecided comparison is retried at the next precision instead of guessed
+- The zero intervals [γ - ε, γ + ε] are the data of the proof: their double end points are exact inputs
+- At PRECISIONS[0] with the native extension the L'/L sum comes from the double-double kernel, whose certified
+  error plus the rounding of the double Λ(k) table (|Λ̃(k) - Λ(k)| <= u Λ(k), and Σ Λ(k)/k^2 < 0.57) becomes the
+  ball radius; that radius does not shrink with the working precision, so higher precisions (and builds without
+  the extension) sum the series in arb over the prime powers
+- Every zero term is positive: a comparison that straddles 0 at some N does not stop the pass, since a later N may
+  still be certain; the precision is raised only if the zeros run out without a certified crossing
+"""
+
+import math
+from typing import Optional, Tuple
+
+import numpy as np
+
+from .native import _native, AVAILABLE as NATIVE_AVAILABLE
+
+try:
+    import flint
+    from flint import arb
+except ImportError:     # python-flint not installed: the certified backend is unavailable
+    flint = None
+    arb = None
+
+AVAILABLE: bool = flint is not None
+PRECISIONS = (64, 128, 256, 512)
+
+UNIT_ROUNDOFF = 2.0 ** -53
+LOG_DERIVATIVE_ZETA_2 = 0.57            # Upper bound of -ζ'/ζ(2) = Σ Λ(k)/k^2 = 0.5699...
+
+
+def _require() -> None:
+    if not AVAILABLE:
+        raise RuntimeError("Certified backend requested but python-flint is not installed (pip install python-flint)")
+
+# =========================== TERMS ===========================
+
+def iota_ball(eta: float) -> "arb":
+    """
+    Purpose:
+        Maximum contribution of missing zeros, min(1/(1+η²) + 2/(4+η²), 12/(9+4η²)) as a ball
+    Input:
+        eta (float): Height η (exact double)
+    Return:
+        arb containing iota(η)
+    """
+    eta2 = arb(eta) * arb(eta)
+    term1 = 1 / (1 + eta2) + 2 / (4 + eta2)
+    term2 = 12 / (9 + 4 * eta2)
+
+    # The minimum is certain unless the balls overlap; then their union contains it
+    if term1 < term2:
+        return term1
+    if term2 < term1:
+        return term2
+    return term1.union(term2)
+
+
+def rhs_const_ball(d: int) -> "arb":
+    """
+    Purpose:
+        Constant term of the RHS, depending only on the sign and size of d
+    Input:
+        d (int): Fundamental discriminant
+    Return:
+        arb
+    """
+    e, pi, euler = arb(1).exp(), arb.pi(), arb.const_euler()
+    if d < 0:
+        return (arb(abs(d)) * e * e / (4 * pi * euler.exp())).log() / 2
+    return (arb(abs(d)) / (pi * euler.exp())).log() / 2
+
+
+def rhs_ball(d: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray) -> "arb":
+    """
+    Purpose:
+        Whole RHS of the base-case inequality, rhs_const_ball(d) + L'/L(2, χ_d) truncated at K with its tail bound
+    Input:
+        d (int): Fundamental discriminant
+        K (int): Truncation parameter
+        chi_arr, lambda_arr (np.ndarray): χ_d(k) and Λ(k) for k = 0..K
+    Return:
+        arb at the current working precision
+    """
+    return rhs_const_ball(d) + log_derivative_ball(-1, K, chi_arr, lambda_arr, remainder_bound=True)
+
+
+def remainder_ball(delta: int, K: int) -> "arb":
+    """
+    Purpose:
+        Analytic upper bound K^δ/δ · (2.85 (2δ - 1) / log K - 1) of the series tail beyond K
+    Input:
+        delta (int): Negative integer
+        K (int): Truncation parameter
+    Return:
+        arb
+    """
+    return (arb(K) ** delta / delta) * (arb("2.85") * (2 * delta - 1) / arb(K).log() - 1)
+
+
+def log_derivative_ball(delta: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray, remainder_bound: bool = True) -> "arb":
+    """
+    Purpose:
+        Ball containing -Σ_{k <= K} Λ(k) χ(k) / k^(1 - delta), plus the tail bound if requested; above PRECISIONS[0]
+        the sum is taken in arb, so its radius follows the working precision
+    Input:
+        delta (int): Negative integer (delta <= -1)
+        K (int): Truncation parameter (>= 18)
+        chi_arr (np.ndarray): χ(k) for k = 0..K
+        lambda_arr (np.ndarray): Λ(k) for k = 0..K (only its support and the primes are used by the arb path)
+        remainder_bound (bool): Whether to add remainder_ball(delta, K)
+    Return:
+        arb
+    """
+    n = 1 - delta
+    if NATIVE_AVAILABLE and flint.ctx.prec <= PRECISIONS[0]:
+        # Double-double kernel: |exact sum over Λ̃ - (hi + lo)| <= err; Λ̃(k) itself is within u Λ(k) of log p
+        chi_arr    = np.ascontiguousarray(chi_arr, dtype=np.int8)
+        lambda_arr = np.ascontiguousarray(lambda_arr, dtype=np.float64)
+        hi, lo, err = _native.dense_series(chi_arr, lambda_arr, K, n)
+        radius = err + 2 * UNIT_ROUNDOFF * LOG_DERIVATIVE_ZETA_2
+        total = -(arb(hi) + arb(lo)) + arb(0, radius)
+    else:
+        # Prime powers only: Λ(p^j) = log p with p recovered from the double table
+        total = arb(0)
+        for k in np.flatnonzero(np.asarray(lambda_arr[:K + 1])):
+            chi = int(chi_arr[k])
+            if chi == 0:
+                continue
+            p = int(round(math.exp(float(lambda_arr[k]))))
+            total -= chi * arb(p).log() / arb(int(k)) ** n
+
+    if remainder_bound:
+        total += remainder_ball(delta, K)
+    return total
+
+
+def zero_term_ball(gamma_minus: float, gamma_plus: float, sym_tol: float = 1e-12) -> "arb":
+    """
+    Purpose:
+        Contribution of one interval: 6/(9 + 4 γ0²) if symmetric (Type 2), else 12/(9 + 4 γ+²) (Type 1)
+    Input:
+        gamma_minus, gamma_plus (float): Interval end points (exact doubles)
+        sym_tol (float): Tolerance of the symmetry test
+    Return:
+        arb
+    """
+    g = arb(abs(gamma_plus))
+    c = 6 if abs(gamma_minus + gamma_plus) <= sym_tol else 12
+    return c / (9 + 4 * g * g)
+
+# =========================== VERIFICATION ===========================
+
+def _decide(rhs: "arb", lhs0: "arb", eps: float, zeros: list) -> Tuple[Optional[bool], int]:
+    # One pass at the current precision: (True, N) proven at the first certain N, (False, len(zeros)) certainly not
+    # enough zeros, (None, len(zeros)) no certain crossing but some N straddled 0 (a higher precision may decide)
+    lhs = lhs0
+    undecided = False
+
+    for N in range(len(zeros) + 1):
+        if N > 0:
+            gamma = zeros[N - 1]
+            lhs += zero_term_ball(gamma - eps, gamma + eps)
+        gap = lhs - rhs
+        if gap > 0:
+            return True, N
+        if not gap <= 0:
+            undecided = True        # Ball straddles 0: the terms are positive, so a later N may still be certain
+    return (None if undecided else False), len(zeros)
+
+
+def certified_gap(d: int, K: int, eta: float, chi_arr: np.ndarray, lambda_arr: np.ndarray) -> Tuple[float, "arb", bool]:
+    """
+    Purpose:
+        Midpoint of rhs - 2 iota(η) at the lowest working precision, to size the first zero request, together
+        with the RHS ball itself so certified_verify does not sum the series again at that precision, and whether
+        2 iota(η) > rhs holds already (N = 0, decided before any zero is computed)
+    Input:
+        d (int): Fundamental discriminant
+        K (int): Truncation parameter
+        eta (float): Height η
+        chi_arr, lambda_arr (np.ndarray): χ_d(k) and Λ(k) for k = 0..K
+    Return:
+        (gap midpoint, RHS ball at PRECISIONS[0], proven without zeros)
+    """
+    _require()
+    saved = flint.ctx.prec
+    try:
+        flint.ctx.prec = PRECISIONS[0]
+        rhs = rhs_ball(d, K, chi_arr, lambda_arr)
+        gap = rhs - 2 * iota_ball(eta)
+        return float(gap.mid()), rhs, bool(gap < 0)
+    finally:
+        flint.ctx.prec = saved
+
+
+def certified_verify(d: int, K: int, eta: float, eps: float, stream, chi_arr: np.ndarray, lambda_arr: np.ndarray, chunk: int = 16, rhs: Optional["arb"] = None) -> Tuple[bool, int, int]:
+    """
+    Purpose:
+        Decide the base case inequality rigorously, raising the working precision only when the zeros run out
+        without a certified crossing after some comparison was undecided
+    Input:
+        d (int): Fundamental discriminant
+        K (int): Truncation parameter
+        eta (float): Height η
+        eps (float): Interval half-width
+        stream (ZeroStream): Zeros of L(s, χ_d)
+        chi_arr, lambda_arr (np.ndarray): χ_d(k) and Λ(k) for k = 0..K
+        chunk (int): Zeros requested up front (requests then double)
+        rhs (Optional[arb]): RHS ball at PRECISIONS[0] from certified_gap, reused at that precision
+    Return:
+        (success, N_used, precision in bits that decided the result)
+    """
+    _require()
+    saved = flint.ctx.prec
+    try:
+        count = max(1, chunk)
+        zeros = list(stream.take(count))
+        for prec in PRECISIONS:
+            flint.ctx.prec = prec
+            # The RHS (with its K-term series) and 2 iota(η) depend on the precision only, not on the zeros
+            rhs_prec = rhs if rhs is not None and prec == PRECISIONS[0] else rhs_ball(d, K, chi_arr, lambda_arr)
+            lhs0 = 2 * iota_ball(eta)
+            while True:
+                outcome, N = _decide(rhs_prec, lhs0, eps, zeros)
+                if outcome is True or len(zeros) < count:
+                    break
+                # No certain crossing yet: fetch a larger prefix and retry at the same precision
+                count *= 2
+                zeros = list(stream.take(count))
+            if outcome is not None:
+                return outcome, N, prec
+        raise RuntimeError(f"Inequality for d = {d} undecided at {PRECISIONS[-1]} bits (lhs - rhs is within rounding of 0)")
+    finally:
+        flint.ctx.prec = saved
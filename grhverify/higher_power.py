@@ -0,0 +1,506 @@
+"""
+higher_power.py
+
+Perform the higher-power verification (even k >= 2) of GRH for a single quadratic Dirichlet L-function, from the
+k-th derivative of log L at the real point s = σ = 1 - delta
+
+Functions:
+    - admissible_height(k, delta): Height γ* = |delta| tan(π / 2k) below which every zero contributes positively
+    - default_delta(k, eta): Smallest |delta| whose admissible window holds eta with room for iota_k
+    - weighted_lambda(K, k, lambda_arr): Λ(n) (log n)^(k-1) for n = 0..K (cached per process)
+    - logarithmic_derivative(k, delta, K, chi_arr, lambda_arr, ...): Lower end of (log L)^(k)(σ, χ_d) = Σ Λ(n)χ(n)(log n)^(k-1)/n^σ
+    - series_tail(k, delta, K): Bound on the series beyond K from ψ(x) <= 1.03883 x
+    - rhs_k(d, k, delta, series_lower): Upper bound of Σ_ρ Re (σ - ρ)^(-k) from the explicit formula
+    - zero_term(gamma_plus, k, delta, symmetric): Lower bound of the contribution of one zero interval
+    - iota(eta, k, delta): Minimum contribution of an off-line pair {β + iγ, 1 - β + iγ} with |γ| < eta
+    - zero_tail(d, k, delta, T): Bound on Σ_{|γ| > T} |σ - ρ|^(-k) over all zeros, from N(T, χ_d)
+    - window_prefix_lower(zeros, eps, k, delta, window): Native lower bounds of the zero_term prefix sums in the window
+    - window_crossing(stream, eps, k, delta, window, lhs0, rhs, arena): Smallest N with lhs0 + Σ_{n <= N} zero_term > rhs
+    - higher_power_verify(d, k, K, eta, eps, ...): Test flow for one d, mirroring base_case_verify
+
+Constants:
+    - PSI_CONSTANT     — Rosser–Schoenfeld: ψ(x) < 1.03883 x for x > 0
+    - N_ERROR          — Trudgian's constants in |N(T, χ) - (T/π) log(qT / 2πe)| <= 0.22737 ℓ + 2 log(1 + ℓ) - 0.5
+    - HEIGHT_FRACTION  — eta / γ* targeted by default_delta
+    - NATIVE_MAX_K     — Largest k handled by the native zero-term kernel
+    - TAIL_ALPHA, TAIL_GUARD_DPS — Exponent and guard digits of the closed-form zero_tail weights
+
+Usage:
+    success, eta, N_used = higher_power_verify(
+        d, k, K, eta, eps, lcalc_path, data_dir, log_path, delta=None, backend="auto"
+    )
+
+Notes
+-----
+- Differentiating the explicit formula k - 1 times removes B(χ), log(q/π) and the Σ 1/ρ terms:
+      Σ_ρ (σ - ρ)^(-k) = -[(log L)^(k)(σ) + 2^(-k) ψ^(k-1)((σ + a)/2)] / (k - 1)!          (k even)
+  with a = 0 for d > 0 and a = 1 for d < 0; the sum over zeros converges absolutely for k >= 2
+- Re (σ - ρ)^(-k) = cos(kθ) / |σ - ρ|^k with θ = arg(σ - ρ), so a zero is only known to contribute positively
+  while |γ| <= (σ - 1) tan(π / 2k) = γ*. Zeros below γ* are summed as in the base case (missing ones only make
+  the LHS smaller); every zero above γ*, known or not, is bounded in absolute value by zero_tail(γ*)
+- The verified height must satisfy eta < γ*: a larger |delta| widens the window but shrinks every term
+  like σ^(-k), so default_delta picks the smallest |delta| that fits eta
+- χ_d, the Λ table, the zero streams / cache and the double-double series kernel (with the weighted table
+  Λ(n)(log n)^(k-1)) are the ones of the base case; only the per-zero and gamma-factor terms are new
+- On the native backend the zero terms go through the compiled prefix kernel (PowerPolicy in contrib.hpp) and the
+  crossing is found by binary search, as in first_crossing; backend "mpmath" keeps the term-by-term reference loop
+- zero_tail depends on d only through log q: the q-free integrals are computed once per (k, delta, T) and combined
+  in closed form, so the window tail costs no quadrature per discriminant
+"""
+
+import math
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+import numpy as np
+import mpmath as mp
+
+from .base_case import SYMMETRY_TOL, crossing_index
+from .native import _native, resolve_backend, BACKENDS
+from .utils import metrics as run_metrics
+from .utils.arena import ScratchArena
+from .utils.data_store import StoreWriter, INDEX_DTYPE
+from .utils.generate_zeros import write_zeros, write_intervals
+from .utils.kronecker_symbol import compute_kronecker, write_kronecker
+from .utils.von_mangoldt import lambda_table
+from .utils.zero_cache import ZeroCache
+from .utils.zero_stream import ZeroStream
+
+PSI_CONSTANT    = mp.mpf("1.03883")
+N_ERROR         = (mp.mpf("0.22737"), mp.mpf("2"), mp.mpf("-0.5"))
+HEIGHT_FRACTION = 0.5
+
+UNIT_ROUNDOFF  = 2.0 ** -53
+NATIVE_MAX_K   = 50      # PowerPolicy::max_k: larger k fall back to the mpmath loop
+TAIL_ALPHA     = "1e-6"  # Exponent of log x <= (x^α - 1) / α in the zero_tail weights
+TAIL_GUARD_DPS = 20      # Extra digits for those weights
+
+_weighted: Dict[Tuple[int, int], np.ndarray] = {}       # (K, k) -> Λ(n)(log n)^(k-1)
+_abs_sums: Dict[Tuple[int, int, int], float] = {}       # (K, k, delta) -> Σ Λ(n)(log n)^(k-1)/n^σ
+_tail_integrals: Dict[Tuple[int, int, mp.mpf, int], Tuple[mp.mpf, ...]] = {}   # (k, delta, T, dps) -> q-free integrals
+
+
+def _check(k: int, delta: int) -> None:
+    if not (isinstance(k, int) and k >= 2 and k % 2 == 0):
+        raise ValueError("k must be an even integer greater than or equal to 2")
+    if not (isinstance(delta, int) and delta < 0):
+        raise ValueError("delta must be a negative integer ")
+
+# =========================== WINDOW ===========================
+
+def admissible_height(k: int, delta: int) -> mp.mpf:
+    """
+    Purpose:
+        Largest |γ| at which Re (σ - ρ)^(-k) >= 0 for every β in [0, 1]: (σ - 1) tan(π / 2k)
+    Input:
+        k (int): Even order
+        delta (int): Negative integer, σ = 1 - delta
+    Return:
+        mp.mpf
+    """
+    _check(k, delta)
+    return -delta * mp.tan(mp.pi / (2 * k))
+
+
+def default_delta(k: int, eta: float) -> int:
+    """
+    Purpose:
+        Smallest |delta| with eta <= HEIGHT_FRACTION * admissible_height(k, delta)
+    Input:
+        k (int): Even order
+        eta (float): Height η
+    Return:
+        Negative integer delta
+    """
+    return -max(1, math.ceil(eta / (HEIGHT_FRACTION * math.tan(math.pi / (2 * k)))))
+
+# =========================== SERIES ===========================
+
+def weighted_lambda(K: int, k: int, lambda_arr: np.ndarray) -> np.ndarray:
+    """
+    Purpose:
+        Table Λ(n) (log n)^(k-1) for n = 0..K, the coefficients of (log L)^(k) (k even)
+    Input:
+        K (int): Truncation parameter
+        k (int): Order
+        lambda_arr (np.ndarray): Λ(n) for n = 0..K
+    Return:
+        np.ndarray float64 (computed once per (K, k) and process)
+    """
+    table = _weighted.get((K, k))
+    if table is None:
+        lam = np.asarray(lambda_arr[:K + 1], dtype=np.float64)
+        logs = np.log(np.maximum(np.arange(K + 1, dtype=np.float64), 1.0))
+        table = np.ascontiguousarray(lam * logs ** (k - 1))
+        _weighted[(K, k)] = table
+    return table
+
+
+def series_tail(k: int, delta: int, K: int) -> mp.mpf:
+    """
+    Purpose:
+        Bound Σ_{n > K} Λ(n) (log n)^(k-1) / n^σ <= 1.03883 (M f(M) + Γ(k, (σ - 1) log M) / (σ - 1)^k) by partial
+        summation against ψ(x) < 1.03883 x, f(x) = (log x)^(k-1) x^(-σ). That needs f decreasing beyond M, so
+        M = max(K, x0) with x0 = e^((k-1)/σ) the maximum of f; if K < x0 the terms in (K, x0] add at most
+        f(x0) ψ(x0) < 1.03883 x0 f(x0)
+    Input:
+        k (int): Even order
+        delta (int): Negative integer
+        K (int): Truncation parameter
+    Return:
+        mp.mpf (bounds the tail of the χ-twisted series in absolute value)
+    """
+    _check(k, delta)
+    sigma = 1 - delta
+    f = lambda x: mp.log(x) ** (k - 1) / mp.power(x, sigma)
+    x0 = mp.exp(mp.mpf(k - 1) / sigma)
+    M = max(mp.mpf(K), x0)
+    rising = x0 * f(x0) if K < x0 else 0
+    integral = mp.gammainc(k, -delta * mp.log(M)) / mp.power(-delta, k)
+    return PSI_CONSTANT * (rising + M * f(M) + integral)
+
+
+def logarithmic_derivative(k: int, delta: int, K: int, chi_arr: np.ndarray, lambda_arr: np.ndarray, remainder_bound: bool = True, backend: str = "auto") -> mp.mpf:
+    """
+    Purpose:
+        Lower end of (log L)^(k)(σ, χ_d) = Σ Λ(n) χ(n) (log n)^(k-1) / n^σ (k even), truncated at K
+    Input:
+        k (int): Even order
+        delta (int): Negative integer, σ = 1 - delta
+        K (int): Truncation parameter (>= 18)
+        chi_arr (np.ndarray): χ(n) for n = 0..K
+        lambda_arr (np.ndarray): Λ(n) for n = 0..K
+        remainder_bound (bool): Whether to subtract series_tail (lower end of the full series)
+        backend (str): "native": double-double kernel on the weighted table, lowered by its certified error
+                       and the rounding of the table itself; "mpmath": term-by-term reference; "auto"
+    Return:
+        mp.mpf
+    """
+    _check(k, delta)
+    if not (isinstance(K, int) and K >= 18):
+        raise ValueError("K must be an integer greater than or equal to 18")
+    sigma = 1 - delta
+    weights = weighted_lambda(K, k, lambda_arr)
+
+    if resolve_backend(backend) == "native":
+        chi_arr = np.ascontiguousarray(chi_arr, dtype=np.int8)
+        hi, lo, err = _native.dense_series(chi_arr, weights, K, sigma)
+
+        # The weighted entries carry ~k roundings each: bound them by the same sum without χ
+        key = (K, k, delta)
+        if key not in _abs_sums:
+            a_hi, a_lo, a_err = _native.dense_series(np.ones(K + 1, dtype=np.int8), weights, K, sigma)
+            _abs_sums[key] = a_hi + a_lo + a_err
+        total = mp.mpf(hi) + mp.mpf(lo) - mp.mpf(err) - mp.mpf(2 * (k + 2) * UNIT_ROUNDOFF * _abs_sums[key])
+    else:
+        total = mp.mpf("0")
+        for n in np.flatnonzero(np.asarray(lambda_arr[:K + 1])):
+            n = int(n)
+            if chi_arr[n] != 0:
+                total += int(chi_arr[n]) * mp.mpf(float(lambda_arr[n])) * mp.log(n) ** (k - 1) / mp.power(n, sigma)
+
+    if remainder_bound:
+        total -= series_tail(k, delta, K)
+    return total
+
+
+def rhs_k(d: int, k: int, delta: int, series_lower: mp.mpf) -> mp.mpf:
+    """
+    Purpose:
+        Upper bound of Σ_ρ Re (σ - ρ)^(-k) = -[(log L)^(k)(σ) + 2^(-k) ψ^(k-1)((σ + a)/2)] / (k - 1)!
+    Input:
+        d (int): Fundamental discriminant (sign gives a)
+        k (int): Even order
+        delta (int): Negative integer
+        series_lower (mp.mpf): Lower end of (log L)^(k)(σ), from logarithmic_derivative
+    Return:
+        mp.mpf
+    """
+    a = 1 if d < 0 else 0
+    gamma_factor = mp.psi(k - 1, mp.mpf(1 - delta + a) / 2) / mp.power(2, k)
+    return -(series_lower + gamma_factor) / mp.factorial(k - 1)
+
+# =========================== ZERO CONTRIBUTIONS ===========================
+
+def zero_term(gamma_plus: mp.mpf, k: int, delta: int, symmetric: bool = False) -> mp.mpf:
+    """
+    Purpose:
+        Lower bound of the contribution of the zeros in one interval: 2 Re (σ - 1/2 - iγ+)^(-k) for a conjugate pair
+        (Type 1), or the single term at γ0 = |γ+| for a symmetric interval (Type 2); decreasing in γ+ on the window
+    Input:
+        gamma_plus (mp.mpf): Upper end of the interval (<= admissible_height)
+        k (int): Even order
+        delta (int): Negative integer
+        symmetric (bool): Type 2 interval [-γ0, γ0]
+    Return:
+        mp.mpf
+    """
+    term = mp.re(mp.power(mp.mpc(mp.mpf(1 - delta) - mp.mpf("0.5"), -mp.fabs(gamma_plus)), -k))
+    return term if symmetric else 2 * term
+
+
+def iota(eta: mp.mpf, k: int, delta: int) -> mp.mpf:
+    """
+    Purpose:
+        Minimum contribution of the pair β + iγ, 1 - β + iγ (β in [0, 1], |γ| < eta): each term is at least
+        cos(k arctan(eta / (σ - 1))) / (σ² + eta²)^(k/2)
+    Input:
+        eta (mp.mpf): Height η (< admissible_height)
+        k (int): Even order
+        delta (int): Negative integer
+    Return:
+        mp.mpf (the conjugate pair adds the same again: the LHS starts at 2 iota, as in the base case)
+    """
+    sigma = mp.mpf(1 - delta)
+    theta = mp.atan(mp.mpf(eta) / (sigma - 1))
+    return 2 * mp.cos(k * theta) / mp.power(sigma ** 2 + mp.mpf(eta) ** 2, mp.mpf(k) / 2)
+
+
+def _zero_count_bounds(q: int, T: mp.mpf) -> Tuple[mp.mpf, mp.mpf]:
+    # Trudgian: N(T, χ) (zeros with |γ| <= T) lies within E(T) of (T/π) log(qT / 2πe), for T >= 1
+    main = T / mp.pi * mp.log(q * T / (2 * mp.pi * mp.e))
+    ell = mp.log(q * (T + 2) / (2 * mp.pi))
+    error = N_ERROR[0] * ell + N_ERROR[1] * mp.log(1 + ell) + N_ERROR[2]
+    return max(mp.mpf(0), main - error), main + error
+
+
+def _moment(k: int, delta: int, T: mp.mpf, s: mp.mpf) -> mp.mpf:
+    # M_s = ∫_T^∞ t^s (-h'(t)) dt (-2 < s < k): t = |delta| tan θ, x = sin²θ turn it into an incomplete beta function
+    x_T = T * T / (mp.mpf(delta) ** 2 + T * T)
+    return k * mp.power(-delta, s - k) / 2 * mp.betainc((s + 2) / 2, (k - s) / 2, x_T, 1)
+
+
+def _tail_weights(k: int, delta: int, T: mp.mpf) -> Tuple[mp.mpf, ...]:
+    # Upper bounds of ∫_T^∞ f(t) (-h'(t)) dt for the q-free pieces f of N⁺(t), as moments (cached: T is the window
+    # of (k, delta) in practice). log(t / T) <= ((t / T)^α - 1) / α for every α > 0, tight as α -> 0 (the guard
+    # digits absorb the cancellation in 1/α); log((t + 2) / (T + 2)) = log(t / T) + log(1 + 2/t) - log(1 + 2/T), and
+    # log(1 + 2u) is concave in u = 1/t, so by Jensen its integral is at most M_0 log(1 + 2 M_-1 / M_0)
+    key = (k, delta, T, mp.dps)
+    if key not in _tail_integrals:
+        with mp.extradps(TAIL_GUARD_DPS):
+            alpha = mp.mpf(TAIL_ALPHA)
+            M = lambda s: _moment(k, delta, T, s)
+            M_0, M_1 = M(0), M(1)
+            log_ratio = lambda s: (M(s + alpha) / mp.power(T, alpha) - M(s)) / alpha    # >= ∫ t^s log(t / T) (-h')
+            weights = (
+                M_0,                                                                    # f = 1 (h(T))
+                M_1 / mp.pi,                                                            # f = t / π
+                (mp.log(T) * M_1 + log_ratio(1)) / mp.pi,                               # f = (t / π) log t
+                log_ratio(0) + M_0 * (mp.log(1 + 2 * M(-1) / M_0) - mp.log(1 + 2 / T)),  # f = log((t + 2) / (T + 2))
+            )
+        _tail_integrals[key] = tuple(+w for w in weights)
+    return _tail_integrals[key]
+
+
+def zero_tail(d: int, k: int, delta: int, T: mp.mpf) -> mp.mpf:
+    """
+    Purpose:
+        Bound Σ_{|γ| > T} |σ - ρ|^(-k) <= -h(T) N⁻(T) + ∫_T^∞ N⁺(t) (-h'(t)) dt with h(t) = ((σ - 1)² + t²)^(-k/2)
+        and N^± the bounds on N(t, χ_d). With L = log q and ℓ(t) = ℓ(T) + log((t + 2) / (T + 2)), every term of N⁺
+        but 2 log(1 + ℓ) is linear in L times a q-free function of t; that one is concave in ℓ, so by Jensen its
+        integral is at most 2 h(T) log(1 + ℓ(T) + I_rel / h(T)), I_rel >= ∫ log((t + 2) / (T + 2)) (-h'(t)) dt.
+        The q-free integrals (_tail_weights: incomplete beta moments, or upper bounds built from them, no
+        quadrature) are cached, so each d costs a few logarithms
+    Input:
+        d (int): Fundamental discriminant
+        k (int): Even order
+        delta (int): Negative integer
+        T (mp.mpf): Height
+    Return:
+        mp.mpf
+    """
+    q, T = abs(d), mp.mpf(T)
+
+    # The zero-counting bound needs T >= 1: zeros in (T, 1] are at most N⁺(1), each at most h(T)
+    if T < 1:
+        h = mp.power(mp.mpf(delta) ** 2 + T * T, -mp.mpf(k) / 2)
+        return h * _zero_count_bounds(q, mp.mpf(1))[1] + zero_tail(d, k, delta, mp.mpf(1))
+
+    I_1, I_t, I_tlog, I_rel = _tail_weights(k, delta, T)
+    ell = mp.log(q) + mp.log((T + 2) / (2 * mp.pi))           # ℓ(T) > 0 for q >= 3
+    pieces = (
+        mp.log(q / (2 * mp.pi * mp.e)) * I_t,                 # (t / π) log(qt / 2πe)
+        I_tlog,
+        N_ERROR[0] * (ell * I_1 + I_rel),                     # 0.22737 ℓ(t)
+        N_ERROR[1] * mp.log(1 + ell + I_rel / I_1) * I_1,     # 2 log(1 + ℓ(t)), Jensen
+        N_ERROR[2] * I_1,                                     # -0.5
+    )
+
+    # The weights are evaluated with TAIL_GUARD_DPS = 20 extra digits, of which the 1/α difference cancels
+    # log10(1/α) = 6: each is within 10^-(dps + 14) of its value relative to the moments, and a piece is a product
+    # of a handful of correctly rounded operations at dps, so 10^-dps of every piece covers both
+    integral = mp.fsum(pieces) + mp.power(10, -mp.dps) * mp.fsum(mp.fabs(p) for p in pieces)
+    return -I_1 * _zero_count_bounds(q, T)[0] + integral
+
+
+def window_prefix_lower(zeros: np.ndarray, eps: float, k: int, delta: int, window: mp.mpf, out: Optional[np.ndarray] = None) -> np.ndarray:
+    """
+    Purpose:
+        Lower bounds of Σ_{n <= N} zero_term(γ_n + ε) for every N whose zeros lie in the window (γ_N + ε <= γ*),
+        rounded towards -inf by the native kernel
+    Input:
+        zeros (np.ndarray): Ordinates γ_1..γ_N in increasing order
+        eps (float): Interval half-width
+        k (int): Even order (<= 50, the reach of the kernel's exact binomials)
+        delta (int): Negative integer
+        window (mp.mpf): Admissible height γ*
+        out (Optional[np.ndarray]): float64 buffer of len(zeros) entries to fill instead of allocating
+    Return:
+        np.ndarray out[:inside], inside the number of leading zeros in the window; non-decreasing
+    """
+    if _native is None:
+        raise RuntimeError("window_prefix_lower needs the native extension (pip install -e .)")
+    zeros = np.ascontiguousarray(zeros, dtype=np.float64)
+    out = np.empty_like(zeros) if out is None else out[:len(zeros)]
+
+    # Round the window down: a zero dropped at the edge only makes the LHS smaller
+    edge = float(window)
+    if mp.mpf(edge) > window:
+        edge = float(np.nextafter(edge, -np.inf))
+    inside = _native.power_prefix_lower(zeros, float(eps), SYMMETRY_TOL, k, 0.5 - delta, edge, out)
+    return out[:inside]
+
+
+def window_crossing(stream: ZeroStream, eps: float, k: int, delta: int, window: mp.mpf, lhs0: mp.mpf, rhs: mp.mpf, arena: Optional[ScratchArena] = None) -> Tuple[bool, int]:
+    """
+    Purpose:
+        Smallest N with lhs0 + Σ_{n <= N} zero_term > rhs over the zeros in the window, as first_crossing does for
+        k = 1: zeros are pulled in doubling blocks, starting from N⁺(γ*) (all of the window, usually)
+    Input:
+        stream (ZeroStream): Zeros of L(s, χ_d)
+        eps (float): Interval half-width
+        k (int): Even order
+        delta (int): Negative integer
+        window (mp.mpf): Admissible height γ*
+        lhs0 (mp.mpf): LHS before any zero, 2 iota - zero_tail
+        rhs (mp.mpf): RHS of the inequality
+        arena (Optional[ScratchArena]): Worker scratch memory holding the prefix sums
+    Return:
+        (success, N): N zeros verify the inequality, or (False, number of zeros in the window / available)
+    """
+    bound = _zero_count_bounds(abs(stream.d), mp.mpf(max(window, 1)))[1]
+    count = max(16, int(mp.ceil(bound)))
+    while True:
+        zeros = np.asarray(stream.take(count), dtype=np.float64)
+        prefix = window_prefix_lower(zeros, eps, k, delta, window, arena.prefix_table(len(zeros)) if arena is not None else None)
+
+        # Stop once the window is exhausted (a zero beyond it), lcalc has no more, or the last bound crosses
+        if len(prefix) < len(zeros) or len(zeros) < count or (len(prefix) and lhs0 + mp.mpf(prefix[-1]) > rhs):
+            break
+        count *= 2
+
+    N = crossing_index(prefix, lhs0, rhs)
+    return (True, N + 1) if N < len(prefix) else (False, len(prefix))
+
+# =========================== VERIFICATION ===========================
+
+def higher_power_verify(d: int, k: int, K: int, eta: float, eps: float, lcalc_path: str | Path, data_dir: str | Path, log_path: str | Path, delta: Optional[int] = None, backend: str = "auto", lambda_arr: Optional[np.ndarray] = None, zero_stream: Optional[ZeroStream] = None, store: Optional[StoreWriter] = None, zero_cache: Optional[ZeroCache] = None, error_log: Optional[List[str]] = None, arena: Optional[ScratchArena] = None) -> Tuple[bool, float, int]:
+    """
+    Purpose:
+        Verify GRH up to height η for χ_d with the k-th derivative of log L (k even), as base_case_verify does with L'/L:
+            2 iota_k(η) + Σ_{γ + ε <= γ*} zero_term - zero_tail(γ*)  >  rhs_k
+        proves that L(s, χ_d) has no zeros off the critical line with |γ| < η
+    Input:
+        d          - Fundamental discriminant
+        k          - Even order (>= 2)
+        K          - Truncation of the series
+        eta        - Height η (must lie below admissible_height(k, delta))
+        eps        - Half-width of the interval around each ordinate
+        lcalc_path - Path to lcalc executable
+        data_dir   - Directory to store the data computed
+        log_path   - Path to write any error logs
+        delta      - Evaluation point σ = 1 - delta (default: default_delta(k, eta))
+        backend    - "auto" | "native" | "mpmath", as in base_case_verify
+        lambda_arr - Precomputed Λ(n) for n = 0..K (default: lambda_table(K))
+        zero_stream - Optional ZeroStream for d owned by the caller
+        store      - Optional StoreWriter for d's block (None: per-d text files)
+        zero_cache - Optional ZeroCache serving previously computed zeros
+        error_log  - If given, error lines are appended here instead of opening log_path
+        arena      - Worker scratch memory reused for χ_d (utils/arena.py)
+    Return:
+        (success: bool, eta_used: float, N_used: int)
+    """
+    if backend not in BACKENDS:
+        raise ValueError(f"backend must be one of {BACKENDS}, got {backend!r}")
+    if delta is None:
+        delta = default_delta(k, eta)
+    window = admissible_height(k, delta)
+    if not eta < window:
+        raise ValueError(f"eta = {eta} is outside the admissible window |γ| < {mp.nstr(window, 6)} for k = {k}, delta = {delta}")
+
+    metrics = run_metrics.current()
+    metrics.set("dps", mp.dps)
+    if arena is not None:
+        arena.reset()
+
+    # --------- Kronecker and Λ arrays, shared with the base case ---------
+    with metrics.stage("kronecker"):
+        chi_arr = compute_kronecker(d, K, backend=backend, out=arena.chi_table(K) if arena is not None else None)
+    if lambda_arr is None:
+        with metrics.stage("lambda"):
+            lambda_arr = lambda_table(K)
+
+    # ------------------------- RHS -------------------------
+    with metrics.stage("series"):
+        rhs = rhs_k(d, k, delta, logarithmic_derivative(k, delta, K, chi_arr, lambda_arr, remainder_bound=True, backend=backend))
+
+    # ----------------------- LHS -----------------------
+    # Missing-zero guard, minus everything the zeros above the admissible window could take away
+    with metrics.stage("lhs"):
+        lhs = 2 * iota(mp.mpf(eta), k, delta) - zero_tail(d, k, delta, window)
+
+    stream = zero_stream if zero_stream is not None else ZeroStream(d, lcalc_path, cache=zero_cache)
+    N_used = 0
+    success = False
+    try:
+        with metrics.stage("lhs"):
+            if lhs > rhs:
+                success = True
+            elif resolve_backend(backend) == "native" and k <= NATIVE_MAX_K:
+                success, N_used = window_crossing(stream, eps, k, delta, window, lhs, rhs, arena)
+            else:
+                # Zeros in the window only: their contributions are certainly positive
+                for gamma in stream:
+                    gamma_minus = mp.mpf(gamma - eps)
+                    gamma_plus  = mp.mpf(gamma + eps)
+                    if gamma_plus > window:
+                        break
+                    symmetric = mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=SYMMETRY_TOL)
+                    lhs += zero_term(gamma_plus, k, delta, symmetric)
+                    N_used += 1
+                    if lhs > rhs:
+                        success = True
+                        break
+
+    except Exception as err:
+        # Log the error (to the caller's sink, or to a file) if computation fails for this d
+        message = f"Error: d = {d}, k = {k}, N = {N_used}, reason = {repr(err)}\n"
+        if error_log is not None:
+            error_log.append(message)
+        else:
+            with open(log_path, "a") as log:
+                log.write(message)
+        success = False
+
+    finally:
+        metrics.count("zeros_used", N_used)
+        if zero_stream is None:
+            stream.close()
+
+    # Same outputs as the base case: the binary store, or zeros / intervals / χ as text
+    if store is not None:
+        with metrics.stage("write"):
+            zeros_all = np.asarray(stream.known, dtype=float)
+            store.add(d, zeros_all, eta, N_used, success)
+        metrics.count("bytes_written", zeros_all.nbytes + INDEX_DTYPE.itemsize)
+        return success, eta, N_used
+
+    with metrics.stage("write"):
+        data_dir = Path(data_dir).expanduser().resolve()
+        zeros_used = np.asarray(stream.known[:N_used], dtype=float)
+        written  = write_zeros(d, [float(z) for z in zeros_used], data_dir)
+        written += write_intervals(d, np.column_stack((zeros_used - eps, zeros_used + eps)), data_dir)
+        written += write_kronecker(d, K, chi_arr, data_dir)
+    metrics.count("bytes_written", written)
+
+    return success, eta, N_used
@@ -0,0 +1,415 @@
+"""
+merge.py
+
+Merge the outputs of sharded (or repeated) sweeps into one deduplicated, indexed result set, and find the
+discriminants no shard has covered
+
+Classes:
+    - MergedRow: One result with its full key (d, eta, K, eps), outcome and provenance
+
+Functions:
+    - shard_rows(output_dir, data_dir, K, eps): Stream of one shard's results sorted by d (summary rows joined with store records)
+    - merge_rows(streams, keep): k-way merge by d keeping one row per (d, eta, K, eps)
+    - write_merged(output_dir, rows): summary.csv sorted by d plus a sparse summary.idx of byte offsets
+    - merged_ds(output_dir): Distinct discriminants of a merged output, streamed in increasing order
+    - lookup(output_dir, d): Rows of d in a merged output, through the index
+    - merge_errors(shard_dirs, output_dir): Deduplicated errors.log of all shards, sorted by d
+    - coverage_gaps(ds, d_min, d_max): Runs of fundamental discriminants in [d_min, d_max] without a row
+    - write_gaps(path, gaps): Write the runs as CSV (lo, hi, missing), one rerun range per line
+
+Constants:
+    - KEEP_POLICIES — "recent" (last written wins) or "rigorous" (verified beats unknown beats failed, then the
+      larger N_needed, then the last written)
+    - INDEX_STRIDE  — Rows between two entries of summary.idx
+    - RUN_ROWS      — Rows per in-memory sort run of an unsorted shard summary
+
+Notes
+-----
+- Nothing is held per shard beyond one d and the shard's errors.log ds: a summary already in d order (e.g. an
+  earlier merge) is streamed as read; one in completion order (worker pool, screening order, reruns) is
+  external-sorted in runs of RUN_ROWS rows spilled to a temporary directory; store indexes are d-sorted and
+  streamed from their mappings. The shards are then merged lazily with heapq.merge
+- summary.csv has no K or eps column: they come from the header of the shard's most recent store file holding
+  d with the same eta (which also gives the success flag), otherwise from the K / eps given for the merge;
+  records of other store files of d (runs with other K / eps) are kept as rows of their own. A d logged in
+  the shard's errors.log without a store record counts as failed; without either its outcome is unknown
+- "Recent" is the modification time of the file holding the row, then its position in the file: summary files
+  are append-only, so a later row of the same key is a rerun
+- A merged output is itself a valid shard (read with its K, eps and success columns), so the runs of gaps.csv
+  can be swept as one more shard and merged in with it
+- summary.idx is a little-endian int64 array of (d, byte offset) pairs for every INDEX_STRIDE-th row; a lookup
+  bisects it and reads at most one stride of rows before those of d
+"""
+
+import csv
+import heapq
+import io
+import itertools
+import math
+import os
+import re
+import tempfile
+from pathlib import Path
+from typing import Dict, Iterable, Iterator, List, NamedTuple, Optional, Sequence, Tuple
+
+import numpy as np
+
+from .utils.data_store import DataStore
+from .utils.discriminant import fundamental_discriminant_segment
+from .utils.results_sink import summary_rows
+
+KEEP_POLICIES = ("recent", "rigorous")
+INDEX_STRIDE  = 1024
+RUN_ROWS      = 1 << 20         # Summary rows sorted in memory at a time before a run is spilled to disk
+RUN_DTYPE     = np.dtype([("d", "<i8"), ("position", "<i8"), ("eta", "<f8"), ("N", "<i8")])
+MERGED_HEADER = ("d", "eta", "K", "eps", "N_needed", "success")
+GAPS_HEADER   = ("lo", "hi", "missing")
+
+_ERROR_D = re.compile(r"d = (-?\d+)")
+
+
+class MergedRow(NamedTuple):
+    d:        int
+    eta:      float
+    K:        int
+    eps:      float
+    N_needed: int
+    success:  Optional[bool]        # None: not recorded (summary row without store record or error line)
+    order:    Tuple[int, int]       # (file mtime in ns, position in the file): larger is more recent
+    source:   str                   # Shard output directory
+
+    @property
+    def key(self) -> Tuple[int, float, int, float]:
+        # Rows of old summaries without an eta column (nan) share one key per (d, K, eps)
+        return self.d, -math.inf if math.isnan(self.eta) else self.eta, self.K, self.eps
+
+
+# =========================== READING ===========================
+
+def _error_ds(output_dir: Path) -> set:
+    path = output_dir / "errors.log"
+    if not path.is_file():
+        return set()
+    return {int(m.group(1)) for m in map(_ERROR_D.search, path.read_text().splitlines()) if m}
+
+
+def _parse_merged(row: List[str], order: Tuple[int, int], source: str) -> MergedRow:
+    success = None if row[5] == "" else bool(int(row[5]))
+    return MergedRow(int(row[0]), float(row[1]), int(row[2]), float(row[3]), int(row[4]), success, order, source)
+
+
+def _is_merged(output_dir: Path) -> bool:
+    path = output_dir / "summary.csv"
+    if not path.is_file():
+        return False
+    with open(path, newline="") as f:
+        return tuple(next(csv.reader(f), ())) == MERGED_HEADER
+
+
+def _summary_mtime(output_dir: Path) -> int:
+    paths = [output_dir / "summary.csv", output_dir / "summary.csv.gz", *sorted((output_dir / "summary_parquet").glob("part-*.parquet"))]
+    return max((p.stat().st_mtime_ns for p in paths if p.is_file()), default=0)
+
+
+def _spill(rows: List[Tuple[int, int, float, int]], directory: Path, number: int) -> Path:
+    path = directory / f"run-{number}.bin"
+    np.array(rows, dtype=RUN_DTYPE).tofile(path)
+    return path
+
+
+def _read_run(path: Path, block: int = 1 << 16) -> Iterator[Tuple[int, int, float, int]]:
+    run = np.memmap(path, dtype=RUN_DTYPE, mode="r")
+    for start in range(0, len(run), block):
+        yield from run[start:start + block].tolist()
+
+
+def _sorted_summary(output_dir: Path) -> Iterator[Tuple[int, int, float, int]]:
+    # (d, position, eta, N) in increasing (d, position): as read when the summary is already sorted, else an
+    # external sort over runs of RUN_ROWS rows spilled to a temporary directory
+    if all(a[0] <= b[0] for a, b in zip(summary_rows(output_dir), itertools.islice(summary_rows(output_dir), 1, None))):
+        for position, (d, eta, N) in enumerate(summary_rows(output_dir)):
+            yield d, position, eta, N
+        return
+
+    with tempfile.TemporaryDirectory(prefix="grh-merge-") as tmp:
+        runs: List[Path] = []
+        chunk: List[Tuple[int, int, float, int]] = []
+        for position, (d, eta, N) in enumerate(summary_rows(output_dir)):
+            chunk.append((d, position, eta, N))
+            if len(chunk) >= RUN_ROWS:
+                chunk.sort()
+                runs.append(_spill(chunk, Path(tmp), len(runs)))
+                chunk = []
+        chunk.sort()
+        if not runs:
+            yield from chunk
+            return
+        if chunk:
+            runs.append(_spill(chunk, Path(tmp), len(runs)))
+        del chunk
+        yield from heapq.merge(*(_read_run(run) for run in runs))
+
+
+def _store_records(data_dir: Optional[str | Path]) -> Iterator[Tuple[int, int, float, int, bool, int, float]]:
+    # (d, file mtime, eta, N_used, success, K, eps) of every store file, merged by d (each index is d-sorted)
+    if data_dir is None:
+        return iter(())
+
+    def records(reader) -> Iterator[Tuple[int, int, float, int, bool, int, float]]:
+        mtime = reader.path.stat().st_mtime_ns
+        for start in range(0, len(reader.index), 1 << 16):
+            for entry in reader.index[start:start + (1 << 16)].tolist():
+                d, _, _, N_used, eta, success, _ = entry
+                yield d, mtime, eta, N_used, bool(success), reader.K, reader.eps
+
+    return heapq.merge(*(records(reader) for reader in DataStore(data_dir).readers))
+
+
+def shard_rows(output_dir: str | Path, data_dir: Optional[str | Path] = None, K: int = 10**5, eps: float = 1e-6) -> Iterator[MergedRow]:
+    """
+    Purpose:
+        Stream the results of one shard as MergedRow sorted by d, holding one d at a time (plus the spilled
+        sort runs when the summary is not in d order)
+    Input:
+        output_dir (str | Path): Shard output directory (summary in any backend, errors.log) or an earlier merged output
+        data_dir (Optional[str | Path]): Shard data directory whose store supplies K, eps and success per d
+        K (int), eps (float): Key of the summary rows the store does not cover
+    Return:
+        Iterator over MergedRow in increasing d (rows of one d: summary rows in file order, then store-only records)
+    """
+    output_dir = Path(output_dir).expanduser()
+    source = str(output_dir)
+    mtime = _summary_mtime(output_dir)
+
+    # An earlier merge is already sorted and carries the full key and outcome of every row
+    if _is_merged(output_dir):
+        with open(output_dir / "summary.csv", newline="") as f:
+            reader = csv.reader(f)
+            next(reader)
+            for position, row in enumerate(reader):
+                if len(row) == len(MERGED_HEADER):
+                    yield _parse_merged(row, (mtime, position), source)
+        return
+
+    failed = _error_ds(output_dir)
+
+    # Summary rows and store records meet d by d: tag 0 / 1 keeps the two kinds apart within a group
+    tagged = heapq.merge(((row[0], 0, row) for row in _sorted_summary(output_dir)),
+                         ((record[0], 1, record) for record in _store_records(data_dir)),
+                         key=lambda item: item[:2])
+    for d, group in itertools.groupby(tagged, key=lambda item: item[0]):
+        summary, stored = [], []
+        for _, tag, item in group:
+            (stored if tag else summary).append(item)
+        stored.sort(key=lambda record: record[1])       # oldest store file first
+
+        # A summary row takes its key from the most recent record of d with the same eta
+        joined = set()
+        for _, position, eta, N in summary:
+            match = next((i for i in reversed(range(len(stored))) if stored[i][2] == eta), None)
+            if match is not None:
+                joined.add(match)
+                _, _, _, _, success, K_store, eps_store = stored[match]
+                yield MergedRow(d, eta, K_store, eps_store, N, success, (mtime, position), source)
+            else:
+                yield MergedRow(d, eta, K, eps, N, False if d in failed else None, (mtime, position), source)
+
+        # Store records without a summary row of their own: a crash between block write and flush, or the
+        # record of an earlier run with other K / eps whose summary row was superseded
+        for i, (_, store_mtime, eta, N, success, K_store, eps_store) in enumerate(stored):
+            if i not in joined:
+                yield MergedRow(d, eta, K_store, eps_store, N, success, (store_mtime, -1), source)
+
+
+# =========================== MERGING ===========================
+
+def _rank(row: MergedRow, keep: str) -> Tuple:
+    if keep == "recent":
+        return row.order
+    outcome = {True: 2, None: 1, False: 0}[row.success]
+    return outcome, row.N_needed, row.order
+
+
+def merge_rows(streams: Sequence[Iterable[MergedRow]], keep: str = "recent") -> Iterator[MergedRow]:
+    """
+    Purpose:
+        k-way merge of per-shard streams sorted by d, keeping one row per (d, eta, K, eps)
+    Input:
+        streams (Sequence[Iterable[MergedRow]]): One d-sorted stream per shard
+        keep (str): One of KEEP_POLICIES
+    Return:
+        Iterator over the kept rows, by d and then by (eta, K, eps)
+    """
+    if keep not in KEEP_POLICIES:
+        raise ValueError(f"keep must be one of {KEEP_POLICIES}, got {keep!r}")
+
+    current: Optional[int] = None
+    best: Dict[Tuple, MergedRow] = {}
+    for row in heapq.merge(*streams, key=lambda row: row.d):
+        if row.d != current:
+            yield from (best[key] for key in sorted(best))
+            current, best = row.d, {}
+        kept = best.get(row.key)
+        if kept is None or _rank(row, keep) > _rank(kept, keep):
+            best[row.key] = row
+    yield from (best[key] for key in sorted(best))
+
+
+# =========================== OUTPUT ===========================
+
+def write_merged(output_dir: str | Path, rows: Iterable[MergedRow]) -> int:
+    """
+    Purpose:
+        Write merged rows (sorted by d) as summary.csv plus the sparse index summary.idx, each via a temporary file
+    Input:
+        output_dir (str | Path): Merged output directory
+        rows (Iterable[MergedRow]): Rows sorted by d
+    Return:
+        Number of distinct discriminants written
+    """
+    output_dir = Path(output_dir).expanduser()
+    output_dir.mkdir(parents=True, exist_ok=True)
+    csv_tmp, idx_tmp = output_dir / ".summary.csv.tmp", output_dir / ".summary.idx.tmp"
+
+    distinct, last = 0, None
+    index: List[Tuple[int, int]] = []
+    with open(csv_tmp, "w", newline="") as f:
+        line = io.StringIO()
+        writer = csv.writer(line)
+        writer.writerow(MERGED_HEADER)
+        offset = f.write(line.getvalue())
+        for count, row in enumerate(rows):
+            if count % INDEX_STRIDE == 0:
+                index.append((row.d, offset))
+            if row.d != last:
+                distinct, last = distinct + 1, row.d
+            line.seek(0)
+            line.truncate()
+            writer.writerow((row.d, row.eta, row.K, row.eps, row.N_needed, "" if row.success is None else int(row.success)))
+            offset += len(line.getvalue().encode())
+            f.write(line.getvalue())
+
+    np.asarray(index, dtype="<i8").reshape(-1, 2).tofile(idx_tmp)
+    os.replace(csv_tmp, output_dir / "summary.csv")
+    os.replace(idx_tmp, output_dir / "summary.idx")
+    return distinct
+
+
+def merged_ds(output_dir: str | Path) -> Iterator[int]:
+    """
+    Purpose:
+        Stream the distinct discriminants of a merged output in increasing order
+    Input:
+        output_dir (str | Path): Merged output directory
+    Return:
+        Iterator over d
+    """
+    with open(Path(output_dir).expanduser() / "summary.csv", newline="") as f:
+        reader = csv.reader(f)
+        next(reader, None)
+        last = None
+        for row in reader:
+            d = int(row[0])
+            if d != last:
+                yield d
+                last = d
+
+
+def lookup(output_dir: str | Path, d: int) -> List[MergedRow]:
+    """
+    Purpose:
+        Rows of d in a merged output: an index bisection, then at most one stride of rows before those of d
+    Input:
+        output_dir (str | Path): Merged output directory
+        d (int): Discriminant
+    Return:
+        List of MergedRow (order = (0, line number), source = the merged summary.csv)
+    """
+    output_dir = Path(output_dir).expanduser()
+    path = output_dir / "summary.csv"
+    index = np.fromfile(output_dir / "summary.idx", dtype="<i8").reshape(-1, 2)
+    if len(index) == 0:
+        return []
+
+    # Rows of d may start before the first index entry equal to d: begin at the last entry below it
+    pos = max(int(np.searchsorted(index[:, 0], d, side="left")) - 1, 0)
+    found: List[MergedRow] = []
+    with open(path, "rb") as raw:
+        raw.seek(int(index[pos, 1]))
+        for number, row in enumerate(csv.reader(io.TextIOWrapper(raw, newline=""))):
+            row_d = int(row[0])
+            if row_d > d:
+                break
+            if row_d == d:
+                found.append(_parse_merged(row, (0, number), str(path)))
+    return found
+
+
+def merge_errors(shard_dirs: Sequence[str | Path], output_dir: str | Path) -> int:
+    """
+    Purpose:
+        Concatenate the errors.log of every shard, dropping repeated lines, sorted by d (lines without a d last)
+    Input:
+        shard_dirs (Sequence[str | Path]): Shard output directories
+        output_dir (str | Path): Merged output directory
+    Return:
+        Number of lines written
+    """
+    lines = {}
+    for shard in shard_dirs:
+        path = Path(shard).expanduser() / "errors.log"
+        if path.is_file():
+            lines.update(dict.fromkeys(path.read_text().splitlines()))
+
+    def by_d(line: str) -> Tuple[int, int]:
+        match = _ERROR_D.search(line)
+        return (0, int(match.group(1))) if match else (1, 0)
+
+    ordered = sorted((line for line in lines if line.strip()), key=by_d)
+    (Path(output_dir).expanduser() / "errors.log").write_text("".join(line + "\n" for line in ordered))
+    return len(ordered)
+
+
+# =========================== COVERAGE ===========================
+
+def coverage_gaps(ds: Iterable[int], d_min: int, d_max: int, segment: int = 1 << 16) -> List[Tuple[int, int, int]]:
+    """
+    Purpose:
+        Maximal runs of consecutive fundamental discriminants in [d_min, d_max] that have no merged row
+    Input:
+        ds (Iterable[int]): Discriminants present, in increasing order (e.g. merged_ds; read once, as a stream)
+        d_min, d_max (int): Inclusive range the sweep was meant to cover
+        segment (int): Integers sieved at a time
+    Return:
+        List of (first missing d, last missing d, number of fundamental d in the run)
+    """
+    present = iter(ds)
+    following = next(present, None)         # smallest present d not yet passed
+    gaps: List[List[int]] = []
+    open_run = False
+    for lo in range(d_min, d_max + 1, segment):
+        for d in fundamental_discriminant_segment(lo, min(lo + segment - 1, d_max)).tolist():
+            while following is not None and following < d:
+                following = next(present, None)
+            absent = following != d
+            if absent and open_run:
+                gaps[-1][1] = d
+                gaps[-1][2] += 1
+            elif absent:
+                gaps.append([d, d, 1])
+            open_run = absent
+    return [tuple(gap) for gap in gaps]
+
+
+def write_gaps(path: str | Path, gaps: Sequence[Tuple[int, int, int]]) -> None:
+    """
+    Purpose:
+        Write the coverage gaps as CSV, one (lo, hi, missing) rerun range per line
+    Input:
+        path (str | Path): Output CSV
+        gaps (Sequence[Tuple[int, int, int]]): Result of coverage_gaps
+    """
+    with open(Path(path).expanduser(), "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(GAPS_HEADER)
+        writer.writerows(gaps)
@@ -0,0 +1,38 @@
+"""
+grhverify.native
+~~~~~~~~~~~~~~~~
+Compiled C++ kernels (built by setup.py as grhverify.native._native) and backend selection
+
+Symbols:
+    - _native: The compiled extension module, or None if it was not built
+    - AVAILABLE: Whether the extension is importable
+    - LCALC_LINKED: Whether the extension was built against the lcalc library (GRH_LCALC_PREFIX)
+    - resolve_backend(backend): Map "auto" | "native" | "mpmath" to the backend actually used
+"""
+
+try:
+    from . import _native
+except ImportError:     # extension not built: only the mpmath reference path is available
+    _native = None
+
+AVAILABLE: bool = _native is not None
+LCALC_LINKED: bool = AVAILABLE and bool(getattr(_native, "HAVE_LCALC", False))
+BACKENDS = ("auto", "native", "mpmath")
+
+
+def resolve_backend(backend: str) -> str:
+    """
+    Purpose:
+        Resolve the requested backend name to the one that will actually run
+    Input:
+        backend (str): "auto" (native if built, else mpmath), "native", or "mpmath"
+    Return:
+        "native" or "mpmath"
+    """
+    if backend not in BACKENDS:
+        raise ValueError(f"backend must be one of {BACKENDS}, got {backend!r}")
+    if backend == "auto":
+        return "native" if AVAILABLE else "mpmath"
+    if backend == "native" and not AVAILABLE:
+        raise RuntimeError("Native backend requested but grhverify.native._native is not built (pip install -e .)")
+    return backend
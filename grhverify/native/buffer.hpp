@@ -0,0 +1,73 @@
+/*
+ * buffer.hpp
+ *
+ * RAII view over a Python buffer-protocol object (NumPy arrays, array.array, memoryview)
+ * so the kernels read the caller's memory directly without copying or boxing
+ *
+ * Types:
+ *   - BufferView: Acquires a C-contiguous buffer and checks its element type
+ */
+
+#pragma once
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstring>
+
+namespace grh {
+
+class BufferView {
+public:
+    BufferView() { std::memset(&view_, 0, sizeof(view_)); }
+    BufferView(const BufferView&) = delete;
+    BufferView& operator=(const BufferView&) = delete;
+    ~BufferView() { if (acquired_) PyBuffer_Release(&view_); }
+
+    /*
+     * Purpose:
+     *     Acquire obj as a C-contiguous buffer whose items have struct code `code`
+     *     ('b' int8, 'd' float64, 'q' int64, 'I' uint32, ...)
+     * Input:
+     *     obj      - Python object exporting the buffer protocol
+     *     code     - Expected struct format character
+     *     name     - Argument name used in error messages
+     *     writable - Whether the kernel writes into the buffer
+     * Return:
+     *     true on success; false with a Python exception set otherwise
+     */
+    bool acquire(PyObject* obj, char code, const char* name, bool writable = false) {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(obj, &view_, flags) != 0) return false;
+        acquired_ = true;
+
+        // Accept native / little-endian prefixes that NumPy may emit ("<d", "=b", "@q")
+        const char* fmt = view_.format ? view_.format : "B";
+        if (*fmt == '@' || *fmt == '=' || *fmt == '<') ++fmt;
+        char got = (fmt[0] != '\0' && fmt[1] == '\0') ? normalise(fmt[0], view_.itemsize) : '\0';
+        if (got != normalise(code, view_.itemsize)) {
+            PyErr_Format(PyExc_TypeError, "%s: expected buffer of type '%c', got '%s'",
+                         name, code, view_.format ? view_.format : "B");
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T> T* data() const { return static_cast<T*>(view_.buf); }
+    Py_ssize_t size() const { return view_.itemsize ? view_.len / view_.itemsize : 0; }
+    int ndim() const { return view_.ndim; }
+    Py_ssize_t shape(int i) const { return view_.shape ? view_.shape[i] : size(); }
+
+private:
+    // 'l' and 'q' (and 'L' / 'Q') name the same 64-bit type on LP64 platforms; NumPy reports 'l'
+    static char normalise(char c, Py_ssize_t itemsize) {
+        if (itemsize == 8 && c == 'l') return 'q';
+        if (itemsize == 8 && c == 'L') return 'Q';
+        return c;
+    }
+
+    Py_buffer view_;
+    bool acquired_ = false;
+};
+
+}  // namespace grh
@@ -0,0 +1,203 @@
+/*
+ * contrib.hpp
+ *
+ * Enclosures of the rational terms of the base case inequality, specialised at compile time by precision policy
+ *
+ *     iota(eta)   = min(1 / (1 + eta^2) + 2 / (4 + eta^2), 12 / (9 + 4 eta^2))
+ *     Type 1 term = 12 / (9 + 4 gamma^2),   Type 2 term = 6 / (9 + 4 gamma0^2)
+ *
+ * and of the higher-power (even k) term Re (a - i gamma)^(-k), a = sigma - 1/2, whose exponent is a run-time parameter
+ *
+ * Types:
+ *   - Ball:         Value hi + lo with |exact - (hi + lo)| <= rad
+ *   - DoublePolicy: One rounded evaluation and an a priori relative bound 4u (the bound of zero_term)
+ *   - DDPolicy:     Double-double denominator and one correction of the quotient, relative bound 32u^2
+ *   - BallPolicy:   Midpoint-radius arithmetic, every radius rounded outwards after each operation
+ *   - PowerPolicy:  Exponent k and abscissa a of the higher-power terms, a priori bound on the binomial expansion
+ *
+ * Functions:
+ *   - add(x, y):                        Sum of two balls
+ *   - contribution<C, P>(g):            Type 1 / Type 2 term at |gamma| = g
+ *   - iota<P>(eta):                     iota(eta)
+ *   - iota_batch<P>(eta, n, hi, lo, rad): iota over an eta vector
+ *   - PowerPolicy::term(g):             Re (a - i g)^(-k)
+ *
+ * Notes
+ * -----
+ * - Every term is num / (a + b g^2) with small integers num, a and b in {1, 4}, so b g^2 is exact given g^2
+ * - DoublePolicy reproduces the doubles of zero_term bit for bit, so zero_prefix_lower<DoublePolicy> is the
+ *   historical kernel; DDPolicy is for grids of heights where 2 iota(eta) is compared against rhs directly,
+ *   BallPolicy needs no error analysis of the formula and is the cross-check of the other two
+ * - The enclosure of a min is the smaller midpoint with the larger radius: if X has the smaller midpoint,
+ *   min(X, Y) >= min(X - rad_X, Y - rad_Y) >= X - max(rad_X, rad_Y)
+ * - PowerPolicy evaluates Re (a + i g)^k / (a^2 + g^2)^k = sum_{j even} (-1)^(j/2) C(k, j) a^(k-j) g^j / (a^2 + g^2)^k;
+ *   for k <= PowerPolicy::max_k every C(k, j) is an exact double, and inside the admissible window (g < a) the
+ *   terms do not cancel badly, so the bound through sum |C(k, j) a^(k-j) g^j| stays within a few ulps
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "dd.hpp"
+
+namespace grh {
+
+struct Ball {
+    double hi  = 0.0;
+    double lo  = 0.0;
+    double rad = 0.0;
+};
+
+enum class Contribution { Type1, Type2 };
+
+namespace detail {
+inline double up(double x) { return std::nextafter(x, std::numeric_limits<double>::infinity()); }
+inline double down(double x) { return std::nextafter(x, -std::numeric_limits<double>::infinity()); }
+}  // namespace detail
+
+// =========================== POLICIES ===========================
+
+struct DoublePolicy {
+    static constexpr const char* name = "double";
+
+    // g*g, a + b g^2 and the division each round once: relative error <= 3u + O(u^2)
+    static Ball quotient(double num, double a, double b, double g) {
+        const double q = num / (a + b * (g * g));
+        return {q, 0.0, 4.0 * unit_roundoff() * q};
+    }
+};
+
+struct DDPolicy {
+    static constexpr const char* name = "dd";
+
+    static Ball quotient(double num, double a, double b, double g) {
+        const double u = unit_roundoff();
+
+        // D = a + b g^2 as (D_hi, D_lo): g^2 and the leading sum exact, one rounding in the tail
+        double s, s_err, D_hi, D_err;
+        two_prod(g, g, s, s_err);
+        two_sum(a, b * s, D_hi, D_err);
+        const double D_lo = D_err + b * s_err;
+
+        // q = num / D_hi, then one correction num - q D = (num - p) - p_err - q D_lo with p + p_err = q D_hi
+        const double q = num / D_hi;
+        double p, p_err;
+        two_prod(q, D_hi, p, p_err);
+        const double r = ((num - p) - p_err) - q * D_lo;     // num - p is exact (Sterbenz)
+        double hi, lo;
+        two_sum(q, r / D_hi, hi, lo);
+        return {hi, lo, 32.0 * u * u * std::fabs(hi) + std::numeric_limits<double>::denorm_min()};
+    }
+};
+
+struct BallPolicy {
+    static constexpr const char* name = "ball";
+
+    static Ball quotient(double num, double a, double b, double g) {
+        using detail::up;
+        using detail::down;
+        const double u = unit_roundoff();
+
+        const double m  = g * g;
+        const double r  = up(u * m);
+        const double Dm = a + b * m;
+        const double Dr = up(b * r + up(u * Dm));
+
+        // |num / D - num / Dm| <= num Dr / (Dm (Dm - Dr)), plus the rounding of the midpoint
+        const double q  = num / Dm;
+        const double qr = up(up(num * Dr) / down(Dm * down(Dm - Dr)));
+        return {q, 0.0, up(qr + up(u * q))};
+    }
+};
+
+struct PowerPolicy {
+    static constexpr const char* name = "power";
+    static constexpr int max_k = 50;
+
+    int    k;       // Even order
+    double a;       // sigma - 1/2 > 0
+
+    Ball term(double g) const {
+        const double u = unit_roundoff();
+        double pa[max_k + 1], pg[max_k + 1];
+        pa[0] = pg[0] = 1.0;
+        for (int i = 1; i <= k; ++i) {
+            pa[i] = pa[i - 1] * a;          // relative error <= (i - 1) u
+            pg[i] = pg[i - 1] * g;
+        }
+
+        // Numerator: each term within (k + 1) u of its value, the signed sum within (k / 2 + 1) u of sum |t|
+        double num = 0.0, mag = 0.0, binom = 1.0;
+        for (int j = 0; j <= k; ++j) {
+            if (j % 2 == 0) {
+                const double t = binom * pa[k - j] * pg[j];
+                num += (j % 4 == 0) ? t : -t;
+                mag += t;
+            }
+            binom = binom * (k - j) / (j + 1);      // exact: C(k, j + 1) and the product stay below 2^53
+        }
+
+        // Denominator (a^2 + g^2)^k: 2u for the base, then k - 1 products, at most 3k u relative
+        const double s = a * a + g * g;
+        double D = s;
+        for (int i = 1; i < k; ++i) D *= s;
+
+        const double q = num / D;
+        const double rad = 1.02 * ((2.0 * k + 2.0) * u * mag + 3.0 * (k + 1) * u * std::fabs(num)) / D
+                         + u * std::fabs(q) + std::numeric_limits<double>::denorm_min();
+        return {q, 0.0, detail::up(rad)};
+    }
+};
+
+// =========================== TERMS ===========================
+
+inline Ball add(const Ball& x, const Ball& y) {
+    const double u = unit_roundoff();
+    double s, e, hi, lo;
+    two_sum(x.hi, y.hi, s, e);
+    const double l = e + (x.lo + y.lo);      // two roundings
+    two_sum(s, l, hi, lo);
+    const double slack = 3.0 * u * (std::fabs(e) + std::fabs(x.lo) + std::fabs(y.lo));
+    return {hi, lo, detail::up(detail::up(x.rad + y.rad) + slack)};
+}
+
+template <Contribution C, class P>
+inline Ball contribution(double g) {
+    return P::quotient(C == Contribution::Type1 ? 12.0 : 6.0, 9.0, 4.0, g);
+}
+
+template <class P>
+inline Ball iota(double eta) {
+    const Ball a = add(P::quotient(1.0, 1.0, 1.0, eta), P::quotient(2.0, 4.0, 1.0, eta));
+    const Ball b = P::quotient(12.0, 9.0, 4.0, eta);
+
+    const bool a_smaller = a.hi < b.hi || (a.hi == b.hi && a.lo <= b.lo);
+    Ball m = a_smaller ? a : b;
+    m.rad = std::max(a.rad, b.rad);
+    return m;
+}
+
+/*
+ * Purpose:
+ *     iota(eta_i) for a vector of heights in one call
+ * Input:
+ *     eta - Heights eta_0..eta_{n-1}
+ *     n   - Number of heights
+ * Output:
+ *     hi, lo, rad - iota(eta_i) in [hi_i + lo_i - rad_i, hi_i + lo_i + rad_i]
+ */
+template <class P>
+inline void iota_batch(const double* eta, std::size_t n, double* hi, double* lo, double* rad) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const Ball v = iota<P>(eta[i]);
+        hi[i]  = v.hi;
+        lo[i]  = v.lo;
+        rad[i] = v.rad;
+    }
+}
+
+}  // namespace grh
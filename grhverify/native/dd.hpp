@@ -0,0 +1,96 @@
+/*
+ * dd.hpp
+ *
+ * Error-free transformations and a double-double accumulator with a running
+ * rigorous error bound, used by the native series kernels
+ *
+ * Types:
+ *   - DDAccumulator: Compensated sum (hi, lo) of doubles plus an upper bound on the
+ *                    absolute rounding error committed so far
+ *
+ * Functions:
+ *   - two_sum(a, b, s, e): s + e == a + b exactly (Knuth)
+ *   - two_prod(a, b, p, e): p + e == a * b exactly (Dekker, no FMA needed)
+ *   - unit_roundoff():     u = 2^-53 for IEEE binary64
+ *
+ * Notes
+ * -----
+ * - The kernels must be compiled without -ffast-math, otherwise the error-free
+ *   transformations are folded away by the optimiser
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace grh {
+
+// =========================== PRIMITIVES ===========================
+
+// Unit roundoff of round-to-nearest binary64 arithmetic
+constexpr double unit_roundoff() {
+    return std::numeric_limits<double>::epsilon() / 2.0;
+}
+
+// Knuth's TwoSum: s = fl(a + b) and e = (a + b) - s exactly, no branch on magnitudes
+inline void two_sum(double a, double b, double& s, double& e) {
+    s = a + b;
+    double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+}
+
+// Veltkamp splitting: a = hi + lo with both halves of at most 26 significant bits
+inline void split(double a, double& hi, double& lo) {
+    const double c = 134217729.0 * a;     // 2^27 + 1
+    hi = c - (c - a);
+    lo = a - hi;
+}
+
+// Dekker's TwoProduct: p = fl(a * b) and e = a * b - p exactly (no overflow or underflow assumed)
+inline void two_prod(double a, double b, double& p, double& e) {
+    double ah, al, bh, bl;
+    split(a, ah, al);
+    split(b, bh, bl);
+    p = a * b;
+    e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+}
+
+// =========================== ACCUMULATOR ===========================
+
+struct DDAccumulator {
+    double hi  = 0.0;   // Leading part of the running sum
+    double lo  = 0.0;   // Trailing part, |lo| <= u |hi| after renormalisation
+    double err = 0.0;   // Upper bound on |exact sum - (hi + lo)| (before final inflation)
+    uint64_t n = 0;     // Number of additions into err, used to inflate err at the end
+
+    /*
+     * Purpose:
+     *     Add a term t whose own absolute error is at most t_err
+     * Input:
+     *     t     - Rounded term
+     *     t_err - Bound on |exact term - t|
+     */
+    inline void add(double t, double t_err) {
+        double s, e;
+        two_sum(hi, t, s, e);       // exact
+        double l = lo + e;          // the only rounded operation: |error| <= u |l|
+        two_sum(s, l, hi, lo);      // exact renormalisation
+        err += unit_roundoff() * std::fabs(l) + t_err;
+        ++n;
+    }
+
+    /*
+     * Purpose:
+     *     Certified bound on |exact sum - (hi + lo)|
+     *     err itself is a floating-point sum of n + 1 non-negative terms, so it is
+     *     inflated by (1 + 2 (n + 1) u) which dominates gamma_{n+1} for n u < 1/4
+     */
+    inline double error_bound() const {
+        const double u = unit_roundoff();
+        return err * (1.0 + 2.0 * static_cast<double>(n + 1) * u) + std::numeric_limits<double>::denorm_min();
+    }
+};
+
+}  // namespace grh
@@ -0,0 +1,139 @@
+/*
+ * kronecker.hpp
+ *
+ * Native Kronecker symbol and sieve-based tables of the quadratic character χ_d(k) = (d|k)
+ *
+ * Functions:
+ *   - kronecker(a, n):             Kronecker symbol (a|n) for 64-bit a and n >= 0 (binary Jacobi)
+ *   - spf_sieve(K):                Smallest-prime-factor table spf[0..K]
+ *   - chi_table(d, K, spf, out):   χ_d(k) for k = 0..K, evaluated only at primes and
+ *                                  filled in by complete multiplicativity
+ *   - chi_matrix(ds, B, ks, m, out): χ_{d_b}(k_j) as an m x B matrix (prime powers x discriminants)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace grh {
+
+// =========================== KRONECKER SYMBOL ===========================
+
+/*
+ * Purpose:
+ *     Kronecker symbol (a|n) for n >= 0 (Cohen, Algorithm 1.4.10)
+ *     Only shifts, comparisons and one modulo reduction of |a| by n: no factorisation
+ * Input:
+ *     a - Any 64-bit integer (the discriminant d)
+ *     n - Non-negative integer
+ * Return:
+ *     -1, 0 or 1
+ */
+inline int kronecker(int64_t a, uint64_t n) {
+    // (a|0) = 1 iff |a| = 1
+    if (n == 0) return (a == 1 || a == -1) ? 1 : 0;
+
+    // Common factor 2
+    if ((a & 1) == 0 && (n & 1) == 0) return 0;
+
+    // Remove powers of two from n: (a|2) = 1 if a ≡ ±1 (mod 8), -1 if a ≡ ±3 (mod 8)
+    int sign = 1;
+    int v = __builtin_ctzll(n);
+    n >>= v;
+    if (v & 1) {
+        int r = static_cast<int>(a & 7);
+        if (r == 3 || r == 5) sign = -sign;
+    }
+
+    // n is odd: (a|n) is the Jacobi symbol; (-1|n) = (-1)^((n-1)/2)
+    uint64_t x;
+    if (a < 0) {
+        x = static_cast<uint64_t>(-(a + 1)) + 1;   // |a| without overflow at INT64_MIN
+        if ((n & 3) == 3) sign = -sign;
+    } else {
+        x = static_cast<uint64_t>(a);
+    }
+
+    // Binary Jacobi on (x|n) with n odd
+    x %= n;
+    while (x != 0) {
+        int t = __builtin_ctzll(x);
+        x >>= t;
+        if ((t & 1) && ((n & 7) == 3 || (n & 7) == 5)) sign = -sign;
+
+        // Quadratic reciprocity for odd x, n
+        if ((x & 3) == 3 && (n & 3) == 3) sign = -sign;
+        uint64_t r = n % x;
+        n = x;
+        x = r;
+    }
+    return n == 1 ? sign : 0;
+}
+
+// =========================== TABLES ===========================
+
+/*
+ * Purpose:
+ *     Linear-time smallest-prime-factor sieve
+ * Input:
+ *     K - Upper bound
+ * Return:
+ *     spf[0..K] with spf[k] the least prime dividing k (spf[0] = spf[1] = 0)
+ */
+inline std::vector<uint32_t> spf_sieve(uint64_t K) {
+    std::vector<uint32_t> spf(K + 1, 0);
+    std::vector<uint32_t> primes;
+    for (uint64_t k = 2; k <= K; ++k) {
+        if (spf[k] == 0) {
+            spf[k] = static_cast<uint32_t>(k);
+            primes.push_back(static_cast<uint32_t>(k));
+        }
+        for (uint32_t p : primes) {
+            if (p > spf[k] || static_cast<uint64_t>(p) * k > K) break;
+            spf[static_cast<uint64_t>(p) * k] = p;
+        }
+    }
+    return spf;
+}
+
+/*
+ * Purpose:
+ *     Fill out[0..K] with χ_d(k); the Kronecker symbol is evaluated only at the primes,
+ *     every composite is the product χ_d(p) χ_d(k / p) with p = spf[k]
+ * Input:
+ *     d   - Discriminant
+ *     K   - Upper bound
+ *     spf - Smallest-prime-factor table covering 0..K
+ * Output:
+ *     out - χ_d(k) for k = 0..K (out[0] = 0)
+ */
+inline void chi_table(int64_t d, uint64_t K, const uint32_t* spf, int8_t* out) {
+    out[0] = 0;
+    if (K >= 1) out[1] = 1;
+    for (uint64_t k = 2; k <= K; ++k) {
+        uint64_t p = spf[k];
+        out[k] = (p == k) ? static_cast<int8_t>(kronecker(d, k))
+                          : static_cast<int8_t>(out[p] * out[k / p]);
+    }
+}
+
+/*
+ * Purpose:
+ *     χ_{d_b}(k_j) for a block of discriminants at selected k (typically the prime powers <= K)
+ * Input:
+ *     ds - Discriminants d_0..d_{B-1}
+ *     ks - Arguments k_0..k_{m-1}
+ * Output:
+ *     out - m x B row-major int8 matrix, out[j * B + b] = (d_b | k_j)
+ */
+inline void chi_matrix(const int64_t* ds, size_t B, const int64_t* ks, size_t m, int8_t* out) {
+    for (size_t j = 0; j < m; ++j) {
+        const uint64_t k = static_cast<uint64_t>(ks[j]);
+        int8_t* row = out + j * B;
+        for (size_t b = 0; b < B; ++b) row[b] = static_cast<int8_t>(kronecker(ds[b], k));
+    }
+}
+
+}  // namespace grh
@@ -0,0 +1,101 @@
+/*
+ * lcalc_binding.hpp
+ *
+ * In-process zero finding for L(s, χ_d) through lcalc's C++ library (libLfunction),
+ * replacing the fork/exec + stdout parsing of the lcalc executable
+ *
+ * Functions:
+ *   - lcalc_zeros(d, count, out): First `count` positive zero ordinates of L(s, χ_d) written to out
+ *
+ * Notes
+ * -----
+ * - Only compiled when GRH_WITH_LCALC is defined (setup.py sets it when GRH_LCALC_PREFIX points to an lcalc install)
+ * - lcalc keeps global state, so calls must be serialised: the binding keeps the GIL held
+ * - The Γ-factor data depend only on the sign of d (γ = 1/2, λ = 0 for even, 1/2 for odd characters) and are
+ *   set up once per sign; the χ_d coefficient buffer is reused across calls
+ */
+
+#pragma once
+
+#ifdef GRH_WITH_LCALC
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <lcalc/L.h>
+
+#include "kronecker.hpp"
+
+namespace grh {
+
+// Γ-factor data of a real primitive character of the given parity, shared by all d of that sign
+struct QuadraticGammaFactor {
+    Double  gamma[2];   // 1-indexed as lcalc expects
+    Complex lambda[2];
+    Complex pole[1];
+    Complex residue[1];
+
+    explicit QuadraticGammaFactor(bool odd) {
+        gamma[1]   = 0.5;
+        lambda[1]  = odd ? 0.5 : 0.0;
+        pole[0]    = 0.0;
+        residue[0] = 0.0;
+    }
+};
+
+inline const QuadraticGammaFactor& gamma_factor(bool odd) {
+    static const QuadraticGammaFactor even_factor(false), odd_factor(true);
+    return odd ? odd_factor : even_factor;
+}
+
+inline void ensure_lcalc_globals() {
+    static bool initialised = false;
+    if (!initialised) {
+        initialize_globals();
+        initialised = true;
+    }
+}
+
+/*
+ * Purpose:
+ *     Compute the first `count` positive zero ordinates of L(s, χ_d) with lcalc's zero finder
+ * Input:
+ *     d     - Fundamental discriminant (|d| > 1)
+ *     count - Number of zeros requested
+ * Output:
+ *     out   - Ordinates in increasing order
+ * Return:
+ *     Number of zeros written (may be less than count if lcalc stops early)
+ */
+inline size_t lcalc_zeros(int64_t d, long count, double* out) {
+    ensure_lcalc_globals();
+
+    // χ_d as a periodic Dirichlet series with period |d| (coefficients 1-indexed)
+    static std::vector<int> coeff;
+    const int64_t q = d < 0 ? -d : d;
+    coeff.assign(static_cast<size_t>(q) + 1, 0);
+    for (int64_t n = 1; n <= q; ++n) coeff[n] = kronecker(d, static_cast<uint64_t>(n));
+
+    // Functional equation: Q = sqrt(|d| / π), root number 1 for real primitive characters
+    const QuadraticGammaFactor& gf = gamma_factor(d < 0);
+    L_function<int> L("chi_d", -1, static_cast<int>(q), coeff.data(), q,
+                      std::sqrt(static_cast<Double>(q) / Pi), Complex(1.0, 0.0), 1,
+                      const_cast<Double*>(gf.gamma), const_cast<Complex*>(gf.lambda), 0,
+                      const_cast<Complex*>(gf.pole), const_cast<Complex*>(gf.residue));
+
+    std::vector<Double> zeros;
+    L.find_zeros(count, 0, 1025, -1, "", &zeros);
+
+    // Keep the positive ordinates, as the command-line tool prints them
+    size_t n_out = 0;
+    for (Double gamma : zeros) {
+        if (gamma > 0 && n_out < static_cast<size_t>(count)) out[n_out++] = static_cast<double>(gamma);
+    }
+    return n_out;
+}
+
+}  // namespace grh
+
+#endif  // GRH_WITH_LCALC
@@ -0,0 +1,505 @@
+/*
+ * module.cpp
+ *
+ * CPython bindings for the native GRH verification kernels (grhverify.native._native)
+ *
+ * Functions exposed to Python:
+ *   - dense_series(chi_arr, lambda_arr, K, n[, k0]): Truncated sum Σ_{k0 <= k <= K} Λ(k)χ(k)/k^n as (hi, lo, err)
+ *   - power_weights(k_idx, lam, n, w, w_err): Shared prime-power weights Λ(k)/k^n (in place)
+ *   - sparse_series_batch(chi_mat, w, w_err, hi, lo, err): Batched signed dot products (in place)
+ *   - range_series(d_lo, primes, lam, K, n, hi, lo, err): Σ Λ(k)χ_d(k)/k^n for consecutive d from residue tables (in place)
+ *   - kronecker(a, n): Kronecker symbol (a|n)
+ *   - kronecker_table(d, K, out): χ_d(k) for k = 0..K from the shared SPF sieve (in place)
+ *   - kronecker_matrix(ds, ks, out): χ_{d_b}(k_j) as an (m x B) int8 matrix (in place)
+ *   - is_squarefree(n): Whether no p^2 divides the 64-bit n (trial division, then Miller-Rabin / Pollard rho)
+ *   - is_fundamental(d): Whether the 64-bit d is a fundamental discriminant
+ *   - fundamental_filter(ds, out): is_fundamental over an int64 array into a uint8 mask (in place)
+ *   - zero_prefix_lower(zeros, eps, sym_tol, out[, policy]): Rigorous lower bounds of the LHS zero-contribution prefix sums (in place)
+ *   - iota_batch(eta, policy, hi, lo, rad): Enclosures of iota(eta_i) for a vector of heights (in place)
+ *   - power_prefix_lower(zeros, eps, sym_tol, k, a, window, out): Lower bounds of the higher-power zero prefix sums (in place)
+ *   - lcalc_zeros(d, count, out): Zero ordinates via the lcalc library (only if built with GRH_WITH_LCALC)
+ *
+ * Attributes:
+ *   - HAVE_LCALC: Whether lcalc_zeros is available
+ *
+ * Notes
+ * -----
+ * - Arrays are passed through the buffer protocol and read in place
+ * - The heavy loops run with the GIL released
+ * - policy is "double", "dd" or "ball" (contrib.hpp); each name selects its own template instantiation
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "buffer.hpp"
+#include "contrib.hpp"
+#include "factor.hpp"
+#include "kronecker.hpp"
+#include "lcalc_binding.hpp"
+#include "range.hpp"
+#include "series.hpp"
+#include "zeros.hpp"
+
+namespace {
+
+// Process-wide smallest-prime-factor sieve, grown on demand while holding the GIL
+// Readers keep their own shared_ptr, so a concurrent regrowth never frees a table in use
+std::shared_ptr<const std::vector<uint32_t>> g_spf;
+
+std::shared_ptr<const std::vector<uint32_t>> shared_spf(uint64_t K) {
+    if (!g_spf || g_spf->size() <= K) {
+        g_spf = std::make_shared<const std::vector<uint32_t>>(grh::spf_sieve(K));
+    }
+    return g_spf;
+}
+
+// Non-negative 64-bit integer argument: ValueError if negative, OverflowError if too large ("K" would wrap both)
+bool parse_u64(PyObject* obj, const char* name, unsigned long long& value) {
+    if (!PyLong_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s must be an int", name);
+        return false;
+    }
+    int overflow = 0;
+    const long long signed_value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (signed_value == -1 && overflow == 0 && PyErr_Occurred()) return false;
+    if (overflow < 0 || (overflow == 0 && signed_value < 0)) {
+        PyErr_Format(PyExc_ValueError, "%s must be non-negative", name);
+        return false;
+    }
+    if (overflow == 0) {
+        value = static_cast<unsigned long long>(signed_value);
+        return true;
+    }
+    value = PyLong_AsUnsignedLongLong(obj);      // Beyond 2^63: OverflowError past 2^64 - 1
+    return !(value == static_cast<unsigned long long>(-1) && PyErr_Occurred());
+}
+
+// =========================== SERIES ===========================
+
+PyObject* py_dense_series(PyObject*, PyObject* args) {
+    PyObject *chi_obj, *lam_obj;
+    unsigned long long K, k0 = 1;
+    int n;
+    if (!PyArg_ParseTuple(args, "OOKi|K", &chi_obj, &lam_obj, &K, &n, &k0)) return nullptr;
+
+    grh::BufferView chi, lam;
+    if (!chi.acquire(chi_obj, 'b', "chi_arr") || !lam.acquire(lam_obj, 'd', "lambda_arr")) return nullptr;
+
+    // Arrays are indexed 0..K
+    if (chi.size() <= static_cast<Py_ssize_t>(K) || lam.size() <= static_cast<Py_ssize_t>(K)) {
+        PyErr_SetString(PyExc_ValueError, "chi_arr and lambda_arr must have at least K + 1 entries");
+        return nullptr;
+    }
+    if (n < 1) {
+        PyErr_SetString(PyExc_ValueError, "exponent n must be a positive integer");
+        return nullptr;
+    }
+
+    grh::SeriesResult res;
+    Py_BEGIN_ALLOW_THREADS
+    res = grh::dense_series(chi.data<int8_t>(), lam.data<double>(), K, n, k0);
+    Py_END_ALLOW_THREADS
+
+    return Py_BuildValue("(ddd)", res.hi, res.lo, res.err);
+}
+
+PyObject* py_power_weights(PyObject*, PyObject* args) {
+    PyObject *k_obj, *lam_obj, *w_obj, *e_obj;
+    int n;
+    if (!PyArg_ParseTuple(args, "OOiOO", &k_obj, &lam_obj, &n, &w_obj, &e_obj)) return nullptr;
+
+    grh::BufferView k_idx, lam, w, w_err;
+    if (!k_idx.acquire(k_obj, 'q', "k_idx") || !lam.acquire(lam_obj, 'd', "lam") ||
+        !w.acquire(w_obj, 'd', "w", true) || !w_err.acquire(e_obj, 'd', "w_err", true)) return nullptr;
+
+    const Py_ssize_t m = k_idx.size();
+    if (lam.size() != m || w.size() != m || w_err.size() != m) {
+        PyErr_SetString(PyExc_ValueError, "k_idx, lam, w and w_err must have equal length");
+        return nullptr;
+    }
+    if (n < 1) {
+        PyErr_SetString(PyExc_ValueError, "exponent n must be a positive integer");
+        return nullptr;
+    }
+    for (Py_ssize_t j = 0; j < m; ++j) {
+        if (k_idx.data<int64_t>()[j] < 1) {
+            PyErr_SetString(PyExc_ValueError, "k_idx entries must be positive");
+            return nullptr;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    grh::power_weights(k_idx.data<int64_t>(), lam.data<double>(), m, n, w.data<double>(), w_err.data<double>());
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_sparse_series_batch(PyObject*, PyObject* args) {
+    PyObject *chi_obj, *w_obj, *e_obj, *hi_obj, *lo_obj, *err_obj;
+    if (!PyArg_ParseTuple(args, "OOOOOO", &chi_obj, &w_obj, &e_obj, &hi_obj, &lo_obj, &err_obj)) return nullptr;
+
+    grh::BufferView chi, w, w_err, hi, lo, err;
+    if (!chi.acquire(chi_obj, 'b', "chi_mat") || !w.acquire(w_obj, 'd', "w") || !w_err.acquire(e_obj, 'd', "w_err") ||
+        !hi.acquire(hi_obj, 'd', "hi", true) || !lo.acquire(lo_obj, 'd', "lo", true) ||
+        !err.acquire(err_obj, 'd', "err", true)) return nullptr;
+
+    // chi_mat is (m prime powers) x (B discriminants)
+    if (chi.ndim() != 2) {
+        PyErr_SetString(PyExc_ValueError, "chi_mat must be a 2-D (prime powers x discriminants) array");
+        return nullptr;
+    }
+    const Py_ssize_t m = chi.shape(0), B = chi.shape(1);
+    if (w.size() != m || w_err.size() != m) {
+        PyErr_SetString(PyExc_ValueError, "w and w_err must have one entry per row of chi_mat");
+        return nullptr;
+    }
+    if (hi.size() != B || lo.size() != B || err.size() != B) {
+        PyErr_SetString(PyExc_ValueError, "hi, lo and err must have one entry per column of chi_mat");
+        return nullptr;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    grh::sparse_series_batch(chi.data<int8_t>(), w.data<double>(), w_err.data<double>(), m, B,
+                             hi.data<double>(), lo.data<double>(), err.data<double>());
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_range_series(PyObject*, PyObject* args) {
+    long long d_lo;
+    unsigned long long K;
+    int n;
+    PyObject *p_obj, *lam_obj, *hi_obj, *lo_obj, *err_obj;
+    if (!PyArg_ParseTuple(args, "LOOKiOOO", &d_lo, &p_obj, &lam_obj, &K, &n, &hi_obj, &lo_obj, &err_obj)) return nullptr;
+
+    grh::BufferView primes, lam, hi, lo, err;
+    if (!primes.acquire(p_obj, 'q', "primes") || !lam.acquire(lam_obj, 'd', "lam") ||
+        !hi.acquire(hi_obj, 'd', "hi", true) || !lo.acquire(lo_obj, 'd', "lo", true) ||
+        !err.acquire(err_obj, 'd', "err", true)) return nullptr;
+
+    const Py_ssize_t P = primes.size(), B = hi.size();
+    if (lam.size() != P) {
+        PyErr_SetString(PyExc_ValueError, "primes and lam must have equal length");
+        return nullptr;
+    }
+    if (lo.size() != B || err.size() != B) {
+        PyErr_SetString(PyExc_ValueError, "hi, lo and err must have equal length");
+        return nullptr;
+    }
+    if (n < 1) {
+        PyErr_SetString(PyExc_ValueError, "exponent n must be a positive integer");
+        return nullptr;
+    }
+    for (Py_ssize_t i = 0; i < P; ++i) {
+        if (primes.data<int64_t>()[i] < 2) {
+            PyErr_SetString(PyExc_ValueError, "primes entries must be >= 2");
+            return nullptr;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    grh::range_series(d_lo, B, primes.data<int64_t>(), lam.data<double>(), P, K, n,
+                      hi.data<double>(), lo.data<double>(), err.data<double>());
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+// =========================== KRONECKER ===========================
+
+PyObject* py_kronecker(PyObject*, PyObject* args) {
+    long long a;
+    PyObject* n_obj;
+    unsigned long long n;
+    if (!PyArg_ParseTuple(args, "LO", &a, &n_obj) || !parse_u64(n_obj, "n", n)) return nullptr;
+    return PyLong_FromLong(grh::kronecker(a, n));
+}
+
+PyObject* py_kronecker_table(PyObject*, PyObject* args) {
+    long long d;
+    unsigned long long K;
+    PyObject* out_obj;
+    if (!PyArg_ParseTuple(args, "LKO", &d, &K, &out_obj)) return nullptr;
+
+    grh::BufferView out;
+    if (!out.acquire(out_obj, 'b', "out", true)) return nullptr;
+    if (out.size() <= static_cast<Py_ssize_t>(K)) {
+        PyErr_SetString(PyExc_ValueError, "out must have at least K + 1 entries");
+        return nullptr;
+    }
+
+    // Sieve (or reuse) under the GIL, then fill without it so several d can run in parallel
+    auto spf = shared_spf(K);
+    Py_BEGIN_ALLOW_THREADS
+    grh::chi_table(d, K, spf->data(), out.data<int8_t>());
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_kronecker_matrix(PyObject*, PyObject* args) {
+    PyObject *d_obj, *k_obj, *out_obj;
+    if (!PyArg_ParseTuple(args, "OOO", &d_obj, &k_obj, &out_obj)) return nullptr;
+
+    grh::BufferView ds, ks, out;
+    if (!ds.acquire(d_obj, 'q', "ds") || !ks.acquire(k_obj, 'q', "ks") || !out.acquire(out_obj, 'b', "out", true)) return nullptr;
+
+    const Py_ssize_t B = ds.size(), m = ks.size();
+    if (out.ndim() != 2 || out.shape(0) != m || out.shape(1) != B) {
+        PyErr_SetString(PyExc_ValueError, "out must be a 2-D (len(ks) x len(ds)) array");
+        return nullptr;
+    }
+    for (Py_ssize_t j = 0; j < m; ++j) {
+        if (ks.data<int64_t>()[j] < 0) {
+            PyErr_SetString(PyExc_ValueError, "ks entries must be non-negative");
+            return nullptr;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    grh::chi_matrix(ds.data<int64_t>(), B, ks.data<int64_t>(), m, out.data<int8_t>());
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+// =========================== FUNDAMENTALITY ===========================
+
+PyObject* py_is_squarefree(PyObject*, PyObject* args) {
+    PyObject* n_obj;
+    unsigned long long n;
+    if (!PyArg_ParseTuple(args, "O", &n_obj) || !parse_u64(n_obj, "n", n)) return nullptr;
+    return PyBool_FromLong(grh::squarefree(n));
+}
+
+PyObject* py_is_fundamental(PyObject*, PyObject* args) {
+    long long d;
+    if (!PyArg_ParseTuple(args, "L", &d)) return nullptr;
+    return PyBool_FromLong(grh::fundamental(d));
+}
+
+PyObject* py_fundamental_filter(PyObject*, PyObject* args) {
+    PyObject *d_obj, *out_obj;
+    if (!PyArg_ParseTuple(args, "OO", &d_obj, &out_obj)) return nullptr;
+
+    grh::BufferView ds, out;
+    if (!ds.acquire(d_obj, 'q', "ds") || !out.acquire(out_obj, 'B', "out", true)) return nullptr;
+    if (out.size() != ds.size()) {
+        PyErr_SetString(PyExc_ValueError, "out must have len(ds) entries");
+        return nullptr;
+    }
+
+    const Py_ssize_t n = ds.size();
+    const int64_t* d = ds.data<int64_t>();
+    uint8_t* mask = out.data<uint8_t>();
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n; ++i) mask[i] = grh::fundamental(d[i]) ? 1 : 0;
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+// =========================== ZEROS ===========================
+
+// Precision policy named by a Python string; -1 with ValueError set otherwise
+enum Policy { POLICY_DOUBLE, POLICY_DD, POLICY_BALL };
+
+int parse_policy(const char* name) {
+    if (std::strcmp(name, grh::DoublePolicy::name) == 0) return POLICY_DOUBLE;
+    if (std::strcmp(name, grh::DDPolicy::name) == 0) return POLICY_DD;
+    if (std::strcmp(name, grh::BallPolicy::name) == 0) return POLICY_BALL;
+    PyErr_Format(PyExc_ValueError, "policy must be 'double', 'dd' or 'ball', got '%s'", name);
+    return -1;
+}
+
+PyObject* py_zero_prefix_lower(PyObject*, PyObject* args) {
+    PyObject *z_obj, *out_obj;
+    double eps, sym_tol;
+    const char* policy_name = grh::DoublePolicy::name;
+    if (!PyArg_ParseTuple(args, "OddO|s", &z_obj, &eps, &sym_tol, &out_obj, &policy_name)) return nullptr;
+    const int policy = parse_policy(policy_name);
+    if (policy < 0) return nullptr;
+
+    grh::BufferView zeros, out;
+    if (!zeros.acquire(z_obj, 'd', "zeros") || !out.acquire(out_obj, 'd', "out", true)) return nullptr;
+    if (out.size() != zeros.size()) {
+        PyErr_SetString(PyExc_ValueError, "out must have one entry per zero");
+        return nullptr;
+    }
+
+    const double* z = zeros.data<double>();
+    const std::size_t N = static_cast<std::size_t>(zeros.size());
+    double* o = out.data<double>();
+    Py_BEGIN_ALLOW_THREADS
+    switch (policy) {
+        case POLICY_DOUBLE: grh::zero_prefix_lower<grh::DoublePolicy>(z, N, eps, sym_tol, o); break;
+        case POLICY_DD:     grh::zero_prefix_lower<grh::DDPolicy>(z, N, eps, sym_tol, o); break;
+        default:            grh::zero_prefix_lower<grh::BallPolicy>(z, N, eps, sym_tol, o); break;
+    }
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_power_prefix_lower(PyObject*, PyObject* args) {
+    PyObject *z_obj, *out_obj;
+    double eps, sym_tol, a, window;
+    int k;
+    if (!PyArg_ParseTuple(args, "OddiddO", &z_obj, &eps, &sym_tol, &k, &a, &window, &out_obj)) return nullptr;
+    if (k < 2 || k > grh::PowerPolicy::max_k || k % 2 != 0) {
+        PyErr_Format(PyExc_ValueError, "k must be even with 2 <= k <= %d", grh::PowerPolicy::max_k);
+        return nullptr;
+    }
+    if (!(a > 0.0)) {
+        PyErr_SetString(PyExc_ValueError, "a = sigma - 1/2 must be positive");
+        return nullptr;
+    }
+
+    grh::BufferView zeros, out;
+    if (!zeros.acquire(z_obj, 'd', "zeros") || !out.acquire(out_obj, 'd', "out", true)) return nullptr;
+    if (out.size() != zeros.size()) {
+        PyErr_SetString(PyExc_ValueError, "out must have one entry per zero");
+        return nullptr;
+    }
+
+    const double* z = zeros.data<double>();
+    const std::size_t N = static_cast<std::size_t>(zeros.size());
+    double* o = out.data<double>();
+    const grh::PowerPolicy policy{k, a};
+    std::size_t inside;
+    Py_BEGIN_ALLOW_THREADS
+    inside = grh::power_prefix_lower(z, N, eps, sym_tol, policy, window, o);
+    Py_END_ALLOW_THREADS
+
+    return PyLong_FromSize_t(inside);
+}
+
+PyObject* py_iota_batch(PyObject*, PyObject* args) {
+    PyObject *eta_obj, *hi_obj, *lo_obj, *rad_obj;
+    const char* policy_name;
+    if (!PyArg_ParseTuple(args, "OsOOO", &eta_obj, &policy_name, &hi_obj, &lo_obj, &rad_obj)) return nullptr;
+    const int policy = parse_policy(policy_name);
+    if (policy < 0) return nullptr;
+
+    grh::BufferView eta, hi, lo, rad;
+    if (!eta.acquire(eta_obj, 'd', "eta") || !hi.acquire(hi_obj, 'd', "hi", true) ||
+        !lo.acquire(lo_obj, 'd', "lo", true) || !rad.acquire(rad_obj, 'd', "rad", true)) return nullptr;
+    const Py_ssize_t n = eta.size();
+    if (hi.size() != n || lo.size() != n || rad.size() != n) {
+        PyErr_SetString(PyExc_ValueError, "hi, lo and rad must have one entry per height");
+        return nullptr;
+    }
+
+    const double* e = eta.data<double>();
+    double *h = hi.data<double>(), *l = lo.data<double>(), *r = rad.data<double>();
+    Py_BEGIN_ALLOW_THREADS
+    switch (policy) {
+        case POLICY_DOUBLE: grh::iota_batch<grh::DoublePolicy>(e, n, h, l, r); break;
+        case POLICY_DD:     grh::iota_batch<grh::DDPolicy>(e, n, h, l, r); break;
+        default:            grh::iota_batch<grh::BallPolicy>(e, n, h, l, r); break;
+    }
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+// =========================== LCALC ===========================
+
+#ifdef GRH_WITH_LCALC
+PyObject* py_lcalc_zeros(PyObject*, PyObject* args) {
+    long long d;
+    long count;
+    PyObject* out_obj;
+    if (!PyArg_ParseTuple(args, "LlO", &d, &count, &out_obj)) return nullptr;
+
+    grh::BufferView out;
+    if (!out.acquire(out_obj, 'd', "out", true)) return nullptr;
+    if (count < 1 || out.size() < count) {
+        PyErr_SetString(PyExc_ValueError, "count must be positive and out must hold count entries");
+        return nullptr;
+    }
+    if (d == 1 || d == -1 || d == 0) {
+        PyErr_SetString(PyExc_ValueError, "lcalc_zeros requires |d| > 1");
+        return nullptr;
+    }
+
+    // lcalc is not thread-safe: keep the GIL so calls are serialised
+    size_t n = grh::lcalc_zeros(d, count, out.data<double>());
+    return PyLong_FromSize_t(n);
+}
+#endif
+
+// =========================== MODULE ===========================
+
+PyMethodDef methods[] = {
+    {"dense_series", py_dense_series, METH_VARARGS,
+     "dense_series(chi_arr, lambda_arr, K, n, k0=1) -> (hi, lo, err)\n"
+     "Sum of Λ(k)χ(k)/k^n for k = k0..K in double-double; |exact - (hi + lo)| <= err"},
+    {"power_weights", py_power_weights, METH_VARARGS,
+     "power_weights(k_idx, lam, n, w, w_err) -> None\n"
+     "Fill w[j] = Λ(k_j)/k_j^n and bounds w_err[j] on their rounding error"},
+    {"sparse_series_batch", py_sparse_series_batch, METH_VARARGS,
+     "sparse_series_batch(chi_mat, w, w_err, hi, lo, err) -> None\n"
+     "For each column b of the (m x B) int8 matrix chi_mat, sum chi_mat[j, b] * w[j] in double-double"},
+    {"range_series", py_range_series, METH_VARARGS,
+     "range_series(d_lo, primes, lam, K, n, hi, lo, err) -> None\n"
+     "For d = d_lo .. d_lo + len(hi) - 1, sum Λ(k)χ_d(k)/k^n over the prime powers k <= K from per-prime residue tables"},
+    {"kronecker", py_kronecker, METH_VARARGS,
+     "kronecker(a, n) -> int\nKronecker symbol (a|n) for 64-bit a and n >= 0"},
+    {"kronecker_table", py_kronecker_table, METH_VARARGS,
+     "kronecker_table(d, K, out) -> None\n"
+     "Fill int8 out[0..K] with χ_d(k); primes via binary Jacobi, composites via the shared SPF sieve"},
+    {"kronecker_matrix", py_kronecker_matrix, METH_VARARGS,
+     "kronecker_matrix(ds, ks, out) -> None\n"
+     "Fill the (len(ks) x len(ds)) int8 matrix out[j, b] = (ds[b] | ks[j])"},
+    {"is_squarefree", py_is_squarefree, METH_VARARGS,
+     "is_squarefree(n) -> bool\nWhether no p^2 divides the 64-bit n >= 0 (small-prime sieve, then Miller-Rabin / Pollard rho)"},
+    {"is_fundamental", py_is_fundamental, METH_VARARGS,
+     "is_fundamental(d) -> bool\nWhether the 64-bit d is a fundamental discriminant"},
+    {"fundamental_filter", py_fundamental_filter, METH_VARARGS,
+     "fundamental_filter(ds, out) -> None\nFill uint8 out[i] with is_fundamental(ds[i])"},
+    {"zero_prefix_lower", py_zero_prefix_lower, METH_VARARGS,
+     "zero_prefix_lower(zeros, eps, sym_tol, out[, policy]) -> None\n"
+     "Fill out[i] with a non-decreasing lower bound of the sum of the first i + 1 zero contributions"},
+    {"power_prefix_lower", py_power_prefix_lower, METH_VARARGS,
+     "power_prefix_lower(zeros, eps, sym_tol, k, a, window, out) -> int\n"
+     "Fill out[i] with a lower bound of the sum of the first i + 1 terms 2 Re (a - i gamma)^(-k) over the leading\n"
+     "zeros with gamma + eps <= window; returns how many zeros that is"},
+    {"iota_batch", py_iota_batch, METH_VARARGS,
+     "iota_batch(eta, policy, hi, lo, rad) -> None\n"
+     "Fill iota(eta[i]) in [hi[i] + lo[i] - rad[i], hi[i] + lo[i] + rad[i]] under the policy 'double', 'dd' or 'ball'"},
+#ifdef GRH_WITH_LCALC
+    {"lcalc_zeros", py_lcalc_zeros, METH_VARARGS,
+     "lcalc_zeros(d, count, out) -> int\n"
+     "Write the first count positive zero ordinates of L(s, χ_d) into the float64 buffer out"},
+#endif
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef module = {
+    PyModuleDef_HEAD_INIT, "_native", "Native kernels for grhverify", -1, methods, nullptr, nullptr, nullptr, nullptr
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit__native(void) {
+    PyObject* m = PyModule_Create(&module);
+    if (m == nullptr) return nullptr;
+#ifdef GRH_WITH_LCALC
+    const int have_lcalc = 1;
+#else
+    const int have_lcalc = 0;
+#endif
+    if (PyModule_AddObject(m, "HAVE_LCALC", PyBool_FromLong(have_lcalc)) != 0) {
+        Py_DECREF(m);
+        return nullptr;
+    }
+    return m;
+}
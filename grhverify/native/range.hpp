@@ -0,0 +1,178 @@
+/*
+ * range.hpp
+ *
+ * Streaming range kernel for the L'/L series of many consecutive discriminants
+ *
+ *     S_d(K) = sum_{p^k <= K} log p · χ_d(p)^k / p^(k n),   d = d_lo, d_lo + 1, ...
+ *
+ * χ_d(p) depends only on d mod p (odd p) or d mod 8 (p = 2), and χ_d(p^k) = χ_d(p)^k, so each prime
+ * contributes one of two precomputed weights W_p(+1), W_p(-1) (or nothing) selected by a residue table
+ *
+ * Functions:
+ *   - prime_weights(p, lam, K, n, ...):   W_p(±1) = Σ_k (±1)^k Λ(p^k) / p^(k n) with error bounds
+ *   - range_series(d_lo, B, primes, ...): S_d(K) for d = d_lo..d_lo + B - 1 in double-double
+ *
+ * Notes
+ * -----
+ * - Work is prime-major: the quadratic-residue table of p is built once per range in O(p) squarings (no
+ *   Kronecker symbols) and then walked with a running residue for every d of the range
+ * - Primes much larger than the range fall back to the binary Jacobi routine per d, which is cheaper than
+ *   building their table
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "dd.hpp"
+#include "kronecker.hpp"
+#include "series.hpp"
+
+namespace grh {
+
+// Primes above TABLE_FACTOR x (range length) use Jacobi per d instead of a residue table
+constexpr uint64_t TABLE_FACTOR = 64;
+
+// Same update as DDAccumulator::add, on per-discriminant arrays
+inline void dd_add(double& h, double& l, double& e, double t, double t_err, double u) {
+    double s, q, hh, ll;
+    two_sum(h, t, s, q);
+    const double lsum = l + q;
+    two_sum(s, lsum, hh, ll);
+    h = hh;
+    l = ll;
+    e += u * std::fabs(lsum) + t_err;
+}
+
+// Weights of one prime: value at χ(p) = +1 and -1, each with a bound on its rounding error
+struct PrimeWeights {
+    double plus, minus;
+    double plus_err, minus_err;
+};
+
+// =========================== WEIGHTS ===========================
+
+/*
+ * Purpose:
+ *     Combine the prime-power terms of p into W_p(+1) = Σ_k t_k and W_p(-1) = Σ_k (-1)^k t_k,
+ *     t_k = Λ(p^k) / p^(k n) over p^k <= K
+ * Input:
+ *     p   - Prime
+ *     lam - Λ(p) (exact double input, shared by every power of p)
+ *     K   - Truncation limit
+ *     n   - Exponent 1 - delta
+ * Return:
+ *     PrimeWeights; each error bound covers the terms' own errors and the recursive summation
+ */
+inline PrimeWeights prime_weights(uint64_t p, double lam, uint64_t K, int n) {
+    const double u = unit_roundoff();
+    PrimeWeights w{0.0, 0.0, 0.0, 0.0};
+    double abs_sum = 0.0;
+    int terms = 0;
+
+    uint64_t q = p;
+    for (int k = 1; q <= K; ++k) {
+        double t_err;
+        const double t = power_term(lam, q, n, t_err);
+        w.plus  += t;
+        w.minus += (k % 2 == 0) ? t : -t;
+        w.plus_err += t_err;
+        abs_sum += std::fabs(t);
+        ++terms;
+        if (q > K / p) break;
+        q *= p;
+    }
+
+    // Recursive summation of `terms` values: |error| <= (terms - 1) u Σ|t| (doubled to absorb O(u^2))
+    const double sum_err = 2.0 * static_cast<double>(terms) * u * abs_sum;
+    w.plus_err += sum_err;
+    w.minus_err = w.plus_err;
+    return w;
+}
+
+// =========================== RANGE SERIES ===========================
+
+/*
+ * Purpose:
+ *     S_d(K) for the B consecutive discriminants d_lo, ..., d_lo + B - 1
+ * Input:
+ *     d_lo   - First discriminant
+ *     B      - Number of discriminants
+ *     primes - Primes p <= K in increasing order
+ *     lam    - Λ(p) for each prime
+ *     P      - Number of primes
+ *     K      - Truncation limit
+ *     n      - Exponent 1 - delta
+ * Output:
+ *     hi, lo, err - Per-discriminant results, |exact - (hi + lo)| <= err
+ */
+inline void range_series(int64_t d_lo, size_t B, const int64_t* primes, const double* lam, size_t P,
+                         uint64_t K, int n, double* hi, double* lo, double* err) {
+    const double u = unit_roundoff();
+    std::vector<double> h(B, 0.0), l(B, 0.0), e(B, 0.0);
+    std::vector<int8_t> table;
+
+    // (d | 2) by d mod 8: 0 for even d, +1 for d = ±1, -1 for d = ±3 (mod 8)
+    static const int8_t KRONECKER_2[8] = {0, 1, 0, -1, 0, -1, 0, 1};
+
+    for (size_t i = 0; i < P; ++i) {
+        const uint64_t p = static_cast<uint64_t>(primes[i]);
+        const PrimeWeights w = prime_weights(p, lam[i], K, n);
+
+        // χ = -1, 0, +1 select the term branch-free
+        const double vals[3] = {w.minus, 0.0, w.plus};
+        const double errs[3] = {w.minus_err, 0.0, w.plus_err};
+
+        // Large primes: binary Jacobi per d is cheaper than building a table of p residues
+        if (p != 2 && p > TABLE_FACTOR * static_cast<uint64_t>(B)) {
+            for (size_t b = 0; b < B; ++b) {
+                const int c = kronecker(d_lo + static_cast<int64_t>(b), p);
+                dd_add(h[b], l[b], e[b], vals[c + 1], errs[c + 1], u);
+            }
+            continue;
+        }
+
+        // Residue table: (d | 2) by d mod 8, else the quadratic residues of p from (p - 1) / 2 squarings
+        uint64_t period;
+        const int8_t* chi_of;
+        if (p == 2) {
+            period = 8;
+            chi_of = KRONECKER_2;
+        } else {
+            period = p;
+            table.assign(p, -1);
+            table[0] = 0;
+            for (uint64_t x = 1; x <= (p - 1) / 2; ++x) table[(x * x) % p] = 1;
+            chi_of = table.data();
+        }
+
+        // Walk the table with a running residue, one wrap-free run at a time
+        const int64_t m = static_cast<int64_t>(period);
+        uint64_t r = static_cast<uint64_t>(((d_lo % m) + m) % m);
+        for (size_t b = 0; b < B; ) {
+            const size_t run = std::min<size_t>(B - b, period - r);
+            const int8_t* row = chi_of + r;
+            for (size_t j = 0; j < run; ++j) {
+                const int c = row[j];
+                dd_add(h[b + j], l[b + j], e[b + j], vals[c + 1], errs[c + 1], u);
+            }
+            b += run;
+            r = 0;
+        }
+    }
+
+    // Inflate the accumulated error sums exactly as DDAccumulator::error_bound does
+    const double inflate = 1.0 + 2.0 * static_cast<double>(P + 1) * u;
+    for (size_t b = 0; b < B; ++b) {
+        hi[b]  = h[b];
+        lo[b]  = l[b];
+        err[b] = e[b] * inflate + std::numeric_limits<double>::denorm_min();
+    }
+}
+
+}  // namespace grh
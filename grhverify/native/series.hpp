@@ -0,0 +1,174 @@
+/*
+ * series.hpp
+ *
+ * Native kernels for the truncated Dirichlet series of the logarithmic derivative
+ *
+ *     S(K) = sum_{k=1..K} Λ(k) χ(k) / k^n,     n = 1 - delta >= 2
+ *
+ * computed in double-double with a certified bound on the total rounding error.
+ * The table values Λ(k) (doubles) and χ(k) (int8) are taken as exact inputs, exactly
+ * as the mpmath reference path in base_case.py does via mp.mpf(lambda_arr[k] * chi_arr[k])
+ *
+ * Functions:
+ *   - power_term(c, k, n, t_err):       c / k^n rounded, with error bound
+ *   - dense_series(chi, lam, K, n, k0): Partial sum over k0 <= k <= K of dense arrays indexed 0..K
+ *   - power_weights(...):               Shared weights Λ(k)/k^n over the prime powers k <= K
+ *   - sparse_series_batch(...):         S(K) for a block of discriminants as a signed dot product
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "dd.hpp"
+
+namespace grh {
+
+// Result of a series evaluation: value hi + lo with |exact - (hi + lo)| <= err
+struct SeriesResult {
+    double hi;
+    double lo;
+    double err;
+};
+
+// =========================== TERMS ===========================
+
+/*
+ * Purpose:
+ *     Compute t = fl(c / k^n) together with a bound t_err >= |c / k^n - t|
+ * Input:
+ *     c     - Numerator (exact double)
+ *     k     - Positive integer base
+ *     n     - Integer exponent >= 1
+ * Return:
+ *     Rounded term; the error bound is written to t_err
+ */
+inline double power_term(double c, uint64_t k, int n, double& t_err) {
+    const double u = unit_roundoff();
+
+    // Try to form k^n exactly in integers (exact as a double if below 2^53)
+    uint64_t p_int = 1;
+    bool exact = true;
+    for (int i = 0; i < n; ++i) {
+        if (p_int > (uint64_t(1) << 53) / k) { exact = false; break; }
+        p_int *= k;
+    }
+
+    double t;
+    if (exact) {
+        // A single correctly rounded division
+        t = c / static_cast<double>(p_int);
+        t_err = 2.0 * u * std::fabs(t);
+    } else {
+        // n - 1 rounded products and one division: relative error <= gamma_n
+        double p = static_cast<double>(k);
+        for (int i = 1; i < n; ++i) p *= static_cast<double>(k);
+        t = c / p;
+        t_err = static_cast<double>(n + 2) * u * std::fabs(t);
+    }
+    return t;
+}
+
+// =========================== DENSE SERIES ===========================
+
+/*
+ * Purpose:
+ *     Evaluate S(K) from dense arrays chi[0..K], lam[0..K] (index 0 unused), or only the terms
+ *     k0 <= k <= K when an earlier partial sum up to k0 - 1 is being extended
+ * Input:
+ *     chi - χ(k) values in {-1, 0, 1}
+ *     lam - Λ(k) values
+ *     K   - Truncation limit
+ *     n   - Exponent 1 - delta
+ *     k0  - First index summed (>= 1)
+ * Return:
+ *     SeriesResult with certified error bound
+ */
+inline SeriesResult dense_series(const int8_t* chi, const double* lam, uint64_t K, int n, uint64_t k0 = 1) {
+    DDAccumulator acc;
+    for (uint64_t k = k0 < 1 ? 1 : k0; k <= K; ++k) {
+        // Skip the (vast majority of) terms that vanish exactly
+        if (chi[k] == 0 || lam[k] == 0.0) continue;
+
+        double t_err;
+        double t = power_term(lam[k] * static_cast<double>(chi[k]), k, n, t_err);
+        acc.add(t, t_err);
+    }
+    return SeriesResult{acc.hi, acc.lo, acc.error_bound()};
+}
+
+// =========================== SPARSE BATCH ===========================
+
+/*
+ * Purpose:
+ *     Precompute the d-independent weights w_j = Λ(k_j) / k_j^n over the m prime powers k_j <= K
+ * Input:
+ *     k_idx - Prime powers k_j
+ *     lam   - Λ(k_j)
+ *     m     - Number of prime powers
+ *     n     - Exponent 1 - delta
+ * Output:
+ *     w     - Rounded weights
+ *     w_err - Bounds on |Λ(k_j)/k_j^n - w_j|
+ */
+inline void power_weights(const int64_t* k_idx, const double* lam, size_t m, int n, double* w, double* w_err) {
+    for (size_t j = 0; j < m; ++j) {
+        w[j] = power_term(lam[j], static_cast<uint64_t>(k_idx[j]), n, w_err[j]);
+    }
+}
+
+/*
+ * Purpose:
+ *     Evaluate S(K) = Σ_j χ_b(k_j) w_j for B discriminants at once
+ *     The χ matrix is laid out prime-power-major (m rows, B contiguous columns) so the inner
+ *     loop runs over discriminants with unit stride and no branches, which the compiler vectorises
+ * Input:
+ *     chi   - m x B row-major matrix of χ_b(k_j) in {-1, 0, 1}
+ *     w     - Shared weights from power_weights
+ *     w_err - Shared weight error bounds
+ *     m, B  - Matrix dimensions
+ * Output:
+ *     hi, lo, err - Per-discriminant results, |exact - (hi + lo)| <= err
+ */
+inline void sparse_series_batch(const int8_t* chi, const double* w, const double* w_err,
+                                size_t m, size_t B, double* hi, double* lo, double* err) {
+    const double u = unit_roundoff();
+    constexpr size_t TILE = 64;     // Columns kept in registers / L1 per pass over the weights
+
+    for (size_t b0 = 0; b0 < B; b0 += TILE) {
+        const size_t nb = (B - b0 < TILE) ? (B - b0) : TILE;
+        double h[TILE] = {0.0}, l[TILE] = {0.0}, e[TILE] = {0.0};
+
+        for (size_t j = 0; j < m; ++j) {
+            const int8_t* row = chi + j * B + b0;
+            const double wj = w[j], ej = w_err[j];
+            for (size_t b = 0; b < nb; ++b) {
+                // χ in {-1, 0, 1}: the product is exact and a zero term adds nothing
+                const double c = static_cast<double>(row[b]);
+                const double t = c * wj;
+
+                // Inlined DDAccumulator::add for a vectorisable loop body
+                double s, q, hh, ll;
+                two_sum(h[b], t, s, q);
+                const double lsum = l[b] + q;
+                two_sum(s, lsum, hh, ll);
+                h[b] = hh;
+                l[b] = ll;
+                e[b] += u * std::fabs(lsum) + std::fabs(c) * ej;
+            }
+        }
+
+        // Inflate the accumulated error sums exactly as DDAccumulator::error_bound does
+        const double inflate = 1.0 + 2.0 * static_cast<double>(m + 1) * u;
+        for (size_t b = 0; b < nb; ++b) {
+            hi[b0 + b]  = h[b];
+            lo[b0 + b]  = l[b];
+            err[b0 + b] = e[b] * inflate + std::numeric_limits<double>::denorm_min();
+        }
+    }
+}
+
+}  // namespace grh
@@ -0,0 +1,134 @@
+/*
+ * zeros.hpp
+ *
+ * Native kernel for the zero side (LHS) of the base case inequality
+ *
+ *     C(Z)_N = sum_{n=1..N} c_n / (9 + 4 gamma_n^2),   c_n = 12 (Type 1) or 6 (Type 2)
+ *
+ * over the intervals [gamma_n - eps, gamma_n + eps], as rigorous lower bounds of every prefix sum, and the same
+ * for the higher-power terms 2 Re (sigma - 1/2 - i gamma_n)^(-k) of the zeros inside the admissible window
+ *
+ * Functions:
+ *   - zero_term<P>(gamma_minus, gamma_plus, sym_tol):      One Type 1 / Type 2 contribution as a Ball under policy P
+ *   - zero_term(gamma_minus, gamma_plus, sym_tol, t_err): The same in DoublePolicy, with error bound
+ *   - zero_prefix_lower<P>(zeros, N, eps, sym_tol, out):  Non-decreasing lower bounds of C(Z)_1..C(Z)_N, terms
+ *                                                         evaluated with precision policy P (contrib.hpp)
+ *   - power_zero_term(gamma_minus, gamma_plus, sym_tol, policy): One higher-power Type 1 / Type 2 contribution
+ *   - power_prefix_lower(zeros, N, eps, sym_tol, policy, window, out): Prefix lower bounds of the higher-power
+ *                                                         terms of the zeros with gamma + eps <= window
+ *
+ * Notes
+ * -----
+ * - The interval ends are formed as fl(gamma - eps), fl(gamma + eps), exactly the doubles the mpmath loop
+ *   in base_case.py converts to mp.mpf, and are then treated as exact inputs
+ * - The bounds only ever round towards -inf, so lhs = 2 iota(eta) + out[N - 1] > rhs still proves the inequality
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "contrib.hpp"
+#include "dd.hpp"
+
+namespace grh {
+
+// =========================== TERMS ===========================
+
+/*
+ * Purpose:
+ *     Contribution of one interval as an enclosure under precision policy P: 6 / (9 + 4 gamma0^2) if it is
+ *     symmetric about 0 (Type 2, gamma0 = |gamma_plus|), else 12 / (9 + 4 gamma_plus^2) (Type 1)
+ * Input:
+ *     gamma_minus, gamma_plus - Interval ends (exact doubles)
+ *     sym_tol                 - Tolerance on |gamma_minus + gamma_plus| for the symmetry test
+ * Return:
+ *     Ball containing the exact term
+ */
+template <class P>
+inline Ball zero_term(double gamma_minus, double gamma_plus, double sym_tol) {
+    const double g = std::fabs(gamma_plus);
+    return std::fabs(gamma_minus + gamma_plus) <= sym_tol ? contribution<Contribution::Type2, P>(g)
+                                                          : contribution<Contribution::Type1, P>(g);
+}
+
+// Higher power: the single term at gamma0 = |gamma_plus| if symmetric (Type 2), else the conjugate pair (Type 1)
+inline Ball power_zero_term(double gamma_minus, double gamma_plus, double sym_tol, const PowerPolicy& policy) {
+    const Ball t = policy.term(std::fabs(gamma_plus));
+    if (std::fabs(gamma_minus + gamma_plus) <= sym_tol) return t;
+    return {2.0 * t.hi, 2.0 * t.lo, 2.0 * t.rad};
+}
+
+// The DoublePolicy term as (t, t_err): t_err >= |exact term - t|
+inline double zero_term(double gamma_minus, double gamma_plus, double sym_tol, double& t_err) {
+    const Ball t = zero_term<DoublePolicy>(gamma_minus, gamma_plus, sym_tol);
+    t_err = t.rad;
+    return t.hi;
+}
+
+// =========================== PREFIX SUMS ===========================
+
+// Running lower bound of the sum of term(0..N-1) (each a Ball), rounded towards -inf
+template <class Term>
+inline void prefix_lower(std::size_t N, Term term, double* out) {
+    const double u = unit_roundoff();
+    const double neg_inf = -std::numeric_limits<double>::infinity();
+
+    DDAccumulator acc;
+    double running = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        const Ball t = term(i);
+        acc.add(t.hi, t.rad);
+        if (t.lo != 0.0) acc.add(t.lo, 0.0);
+
+        // s = fl(hi + lo) is within u|s| of hi + lo; 3u|s| also absorbs the rounding of the margin itself
+        const double s = acc.hi + acc.lo;
+        const double margin = acc.error_bound() + 3.0 * u * std::fabs(s);
+        const double lower = std::nextafter(s - margin, neg_inf);
+
+        // The sums only grow with N (every term is positive), so a previous lower bound stays valid
+        if (lower > running) running = lower;
+        out[i] = running;
+    }
+}
+
+/*
+ * Purpose:
+ *     Fill out[i] <= C(Z)_{i+1} for i = 0..N-1, non-decreasing in i, so the first N with
+ *     2 iota(eta) + C(Z)_N > rhs can be located by binary search
+ * Input:
+ *     zeros   - Ordinates gamma_1..gamma_N
+ *     N       - Number of zeros
+ *     eps     - Interval half-width
+ *     sym_tol - Tolerance of the Type 2 symmetry test
+ *     out     - Output buffer of N doubles
+ */
+template <class P = DoublePolicy>
+inline void zero_prefix_lower(const double* zeros, std::size_t N, double eps, double sym_tol, double* out) {
+    prefix_lower(N, [&](std::size_t i) { return zero_term<P>(zeros[i] - eps, zeros[i] + eps, sym_tol); }, out);
+}
+
+/*
+ * Purpose:
+ *     Lower bounds of the higher-power zero sums over the leading zeros inside the admissible window
+ * Input:
+ *     zeros   - Ordinates gamma_1..gamma_N in increasing order
+ *     N       - Number of zeros
+ *     eps     - Interval half-width
+ *     sym_tol - Tolerance of the Type 2 symmetry test
+ *     policy  - Exponent k and a = sigma - 1/2
+ *     window  - Admissible height, rounded down: zeros with gamma + eps > window are left out
+ *     out     - Output buffer of N doubles; the first `inside` entries are filled
+ * Return:
+ *     inside, the number of leading zeros with gamma + eps <= window
+ */
+inline std::size_t power_prefix_lower(const double* zeros, std::size_t N, double eps, double sym_tol, const PowerPolicy& policy, double window, double* out) {
+    std::size_t inside = 0;
+    while (inside < N && zeros[inside] + eps <= window) ++inside;
+    prefix_lower(inside, [&](std::size_t i) { return power_zero_term(zeros[i] - eps, zeros[i] + eps, sym_tol, policy); }, out);
+    return inside;
+}
+
+}  // namespace grh
@@ -0,0 +1,96 @@
+"""
+range_engine.py
+
+Streaming evaluation of the RHS series L'/L(1 - delta, χ_d) for whole ranges of consecutive discriminants
+
+Functions:
+    - prime_table(K, lambda_arr): The primes p <= K and their Λ(p), read off the shared Λ table
+    - logarithmic_derivative_range(d_min, d_max, K, ...): L'/L(1 - delta, χ_d) for every fundamental d in [d_min, d_max]
+
+Notes
+-----
+- χ_d(p) depends only on d mod p (d mod 8 for p = 2), and χ_d(p^k) = χ_d(p)^k, so the whole prime-power sum
+  collapses to one of two weights per prime, W_p(+1) or W_p(-1), chosen by a quadratic-residue table
+- The native kernel (range.hpp) builds each table once per segment and walks it with a running residue over
+  the d of the segment; primes much larger than the segment fall back to binary Jacobi per d
+- No χ_d array is built: with segments of 2^16 discriminants and K = 10^5 a d costs about 40 µs
+- Values match logarithmic_derivative(backend="native"): the certified upper end of the sum plus the tail bound
+"""
+
+from typing import Dict, Optional, Tuple
+
+import numpy as np
+import mpmath as mp
+
+from .base_case import remainder_term
+from .native import _native
+from .utils.discriminant import fundamental_discriminant_segment
+from .utils.von_mangoldt import lambda_table
+
+SEGMENT = 1 << 16       # Discriminants per kernel call (long segments amortise the residue tables)
+
+
+def prime_table(K: int, lambda_arr: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    Purpose:
+        Extract the primes p <= K and Λ(p) = log p from a Λ table (prime powers p^k, k >= 2, are left out)
+    Input:
+        K (int): Truncation parameter
+        lambda_arr (np.ndarray): Λ(k) for k = 0..K
+    Return:
+        (primes int64, lam float64)
+    """
+    lam_all = np.asarray(lambda_arr[:K + 1], dtype=np.float64)
+    k_idx = np.flatnonzero(lam_all)
+
+    # k is prime exactly when Λ(k) = log k (for p^j, j >= 2, Λ = log p = log(k) / j)
+    is_prime = np.abs(np.exp(lam_all[k_idx]) - k_idx) < 0.5
+    primes = np.ascontiguousarray(k_idx[is_prime], dtype=np.int64)
+    return primes, np.ascontiguousarray(lam_all[primes])
+
+
+def logarithmic_derivative_range(d_min: int, d_max: int, K: int, delta: int = -1, remainder_bound: bool = True, lambda_arr: Optional[np.ndarray] = None, segment: int = SEGMENT) -> Dict[int, mp.mpf]:
+    """
+    Purpose:
+        Evaluate L'/L(1 - delta, χ_d) as logarithmic_derivative does, for every fundamental discriminant of a range
+    Input:
+        d_min, d_max (int): Inclusive range
+        K (int): Truncation parameter (>= 18)
+        delta (int): Negative integer
+        remainder_bound (bool): Whether to add the analytic tail bound
+        lambda_arr (Optional[np.ndarray]): Λ(k) for k = 0..K (default: the process-wide lambda_table(K))
+        segment (int): Discriminants per kernel call
+    Return:
+        Dict mapping each fundamental d to its mp.mpf value
+    """
+    if _native is None:
+        raise RuntimeError("logarithmic_derivative_range needs the native extension (pip install -e .)")
+    if not (isinstance(delta, int) and delta < 0):
+        raise ValueError("delta must be a negative integer ")
+    if not (isinstance(K, int) and K >= 18):
+        raise ValueError("K must be an integer greater than or equal to 18")
+    if lambda_arr is None:
+        lambda_arr = lambda_table(K)
+
+    primes, lam = prime_table(K, lambda_arr)
+    tail = remainder_term(delta, K) if remainder_bound else mp.mpf("0")
+
+    results: Dict[int, mp.mpf] = {}
+    for lo in range(d_min, d_max + 1, segment):
+        hi_d = min(lo + segment - 1, d_max)
+        fundamental = fundamental_discriminant_segment(lo, hi_d)
+        if len(fundamental) == 0:
+            continue
+
+        # One kernel call over the contiguous span of the segment's fundamental discriminants
+        first, last = int(fundamental[0]), int(fundamental[-1])
+        width = last - first + 1
+        hi, lo_part, err = np.empty(width), np.empty(width), np.empty(width)
+        _native.range_series(first, primes, lam, K, 1 - delta, hi, lo_part, err)
+
+        # Same sign convention and upward rounding as logarithmic_derivative(backend="native")
+        for d in fundamental:
+            b = int(d) - first
+            results[int(d)] = -(mp.mpf(float(hi[b])) + mp.mpf(float(lo_part[b]))) + mp.mpf(float(err[b])) + tail
+
+    return results
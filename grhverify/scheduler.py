@@ -0,0 +1,501 @@
+"""
+scheduler.py
+
+Split discriminant sweeps into blocks and run them serially, on a local worker pool, or as one shard of a
+multi-node sweep
+
+Classes:
+    - SweepConfig: Parameters shared by every discriminant of a sweep (picklable, sent once per worker)
+
+Functions:
+    - parse_shard(text): Parse "--shard i/n" into (i, n)
+    - parse_targets(text, eps): Parse "--targets ETA[:EPS],..." into (eta, eps) pairs
+    - d_blocks(d_min, d_max, block_size): Contiguous blocks [lo, hi] covering the range
+    - shard_blocks(blocks, index, count): Round-robin subset of the blocks owned by shard index/count
+    - verify_discriminant(d, config, lambda_arr, stream, store, cache, log_derivative): Choose eta and run base_case_verify
+      (k = 1) or higher_power_verify (even k) for one d
+    - verify_discriminant_targets(d, config, ...): One result per (eta, eps) of config.targets, from one RHS and zero stream
+    - prefetched_streams(ds, config, series, fetcher, cache): Zero streams opened and filled by a background
+      thread ahead of the verification, through a bounded queue
+    - verify_block(block, config, lambda_arr, skip): Verify every fundamental discriminant of one block, with
+      the RHS series of the whole block computed up front by the range engine
+    - process_arena(K): The ScratchArena shared by every d verified in this process
+    - run_sweep(blocks, config, jobs, completed): Yield (d, success, eta, N_used, metrics, error) over all blocks, in completion order
+
+Notes
+-----
+- With jobs > 1, blocks are pulled from a shared queue one at a time by whichever worker is idle, so
+  expensive blocks (large |d|, many zeros) do not leave the other cores waiting on a static split
+- Every worker owns its lcalc streams and memory-maps the shared read-only data/von_mangoldt.bin
+- Rows therefore arrive out of order when jobs > 1; summaries are keyed by d, not position
+- Discriminants in `completed` (from a previous run's summary / journal) are skipped before any lcalc or χ work
+- Each result carries the stage timers and counters of its d (utils/metrics.py); per-block work (range engine
+  series, store file) is shared out evenly over the block's discriminants
+- With config.targets a discriminant yields one result per target; only the first carries the metrics
+  snapshot (the others an empty dict) so per-d work is counted once
+- With config.prefetch > 0 a thread per worker runs lcalc for the next discriminants (up to prefetch of
+  them, bounded queue) while the worker computes χ, the series and the LHS of the current one; lcalc runs
+  in its own process, so the two overlap fully. The zero request per d is sized from the RHS the range
+  engine already holds, so the verification usually finds every zero it needs waiting
+- Each process keeps one ScratchArena (utils/arena.py) sized from K and ZERO_CAP and reused by every d it
+  verifies, so a worker's scratch memory stays flat however long the sweep runs
+- Error lines travel with the results as well, so the parent process (driver.py's ResultsSink) is the only
+  writer of summary.csv, metrics.csv and errors.log
+"""
+
+import multiprocessing as mp_proc
+import queue
+import threading
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import AbstractSet, Dict, FrozenSet, Iterable, Iterator, List, Optional, Tuple
+
+import numpy as np
+import mpmath as mp
+
+from .base_case import base_case_verify, base_case_verify_targets, iota, predicted_zero_count, rhs_constant, ZERO_CAP
+from .higher_power import higher_power_verify
+from .native import resolve_backend
+from .range_engine import logarithmic_derivative_range
+from .utils.discriminant import fundamental_discriminant_segment
+from .utils.von_mangoldt import lambda_table
+from .utils.zero_stream import ZeroStream, ZeroBatchFetcher
+from .utils.data_store import StoreWriter
+from .utils.zero_cache import ZeroCache
+from .utils.arena import ScratchArena
+from .utils import metrics as run_metrics
+
+Block  = Tuple[int, int]                    # Inclusive discriminant range [lo, hi]
+Result = Tuple[int, bool, float, int, Dict[str, float], Optional[str]]     # (d, success, eta, N_used, metrics snapshot, error lines)
+
+# =========================== CONFIGURATION ===========================
+
+@dataclass(frozen=True)
+class SweepConfig:
+    K:           int
+    eps:         float
+    lcalc_path:  Path
+    data_dir:    Path
+    log_path:    Path
+    eta:         Optional[float] = None     # None: first zero + 2 eps per d
+    backend:     str = "auto"
+    batch_zeros: int = 0                    # Zeros prefetched per d by batched lcalc runs (0 = off)
+    batch_width: int = 1000
+    data_format: str = "store"              # "store": one binary file per block; "text": legacy per-d text files
+    zero_cache:  bool = True                # Reuse zeros computed by earlier runs (data_dir/zero_cache)
+    K_start:     Optional[int] = None       # Adaptive truncation: first K tried per d (None: always K)
+    k:           int = 1                    # 1: base case (L'/L); even k >= 2: higher_power_verify
+    delta:       Optional[int] = None       # Evaluation point 1 - delta for k >= 2 (None: chosen from eta)
+    targets:     Optional[Tuple[Tuple[Optional[float], float], ...]] = None    # k = 1: several (eta, eps) per pass (eta None: first zero + 2 eps)
+    prefetch:    int = 0                    # Discriminants whose zeros a background thread fetches ahead (0 = off)
+
+    @property
+    def store_eps(self) -> float:
+        """Interval half-width recorded in the store header: the store keeps the first target's zeros and outcome"""
+        return self.targets[0][1] if self.targets else self.eps
+
+
+def parse_shard(text: str) -> Tuple[int, int]:
+    """
+    Purpose:
+        Parse a shard specification "i/n" (0 <= i < n)
+    Input:
+        text (str): Shard specification
+    Return:
+        (index, count)
+    """
+    try:
+        index, count = (int(part) for part in text.split("/"))
+    except ValueError as err:
+        raise ValueError(f"--shard must look like i/n, got {text!r}") from err
+    if not (count >= 1 and 0 <= index < count):
+        raise ValueError(f"--shard {text}: need 0 <= i < n")
+    return index, count
+
+
+def parse_targets(text: str, eps: float) -> Tuple[Tuple[Optional[float], float], ...]:
+    """
+    Purpose:
+        Parse a target list "ETA[:EPS],..." (ETA "auto": first zero + 2 EPS; EPS defaults to eps)
+    Input:
+        text (str): Target specification, e.g. "auto,6,6:1e-4"
+        eps (float): Default interval half-width
+    Return:
+        Tuple of (eta or None, eps), duplicates removed, in the given order
+    """
+    targets = []
+    for item in text.split(","):
+        eta_text, _, eps_text = item.strip().partition(":")
+        try:
+            target = (None if eta_text == "auto" else float(eta_text), float(eps_text) if eps_text else eps)
+        except ValueError as err:
+            raise ValueError(f"--targets entries must look like ETA[:EPS] or auto[:EPS], got {item!r}") from err
+        if (target[0] is not None and target[0] <= 0) or target[1] <= 0:
+            raise ValueError(f"--targets {item}: eta and eps must be positive")
+        targets.append(target)
+    return tuple(dict.fromkeys(targets))
+
+# =========================== BLOCKS ===========================
+
+def d_blocks(d_min: int, d_max: int, block_size: int) -> Iterator[Block]:
+    """
+    Purpose:
+        Cover [d_min, d_max] with contiguous blocks of block_size discriminants
+    Input:
+        d_min, d_max (int): Inclusive range
+        block_size (int): Discriminants per block
+    Return:
+        Iterator of (lo, hi) blocks
+    """
+    if block_size < 1:
+        raise ValueError("block_size must be a positive integer")
+    for lo in range(d_min, d_max + 1, block_size):
+        yield lo, min(lo + block_size - 1, d_max)
+
+
+def shard_blocks(blocks: Iterable[Block], index: int, count: int) -> Iterator[Block]:
+    """
+    Purpose:
+        Keep every count-th block starting at index, so shards interleave over |d| and get similar costs
+    Input:
+        blocks: Block sequence (identical on every node)
+        index, count (int): This shard and the total number of shards
+    Return:
+        Iterator over this shard's blocks
+    """
+    for position, block in enumerate(blocks):
+        if position % count == index:
+            yield block
+
+# =========================== PER-DISCRIMINANT WORK ===========================
+
+def verify_discriminant(d: int, config: SweepConfig, lambda_arr: np.ndarray, stream: Optional[ZeroStream] = None, store: Optional[StoreWriter] = None, cache: Optional[ZeroCache] = None, log_derivative=None, arena: Optional[ScratchArena] = None) -> Result:
+    """
+    Purpose:
+        Run the base case verification for one fundamental discriminant
+    Input:
+        d (int): Fundamental discriminant
+        config (SweepConfig): Sweep parameters
+        lambda_arr (np.ndarray): Shared Λ table for K
+        stream (Optional[ZeroStream]): Zero stream for d (a new one is created if omitted)
+        store (Optional[StoreWriter]): Binary store of d's block (None: legacy text files)
+        cache (Optional[ZeroCache]): Zero cache seeding a newly created stream
+        log_derivative (Optional[mp.mpf]): L'/L(2, χ_d) precomputed by the range engine
+        arena (Optional[ScratchArena]): Scratch memory of this process
+    Return:
+        (d, success, eta, N_used, metrics snapshot, error lines or None)
+    """
+    metrics = run_metrics.begin()
+    errors: List[str] = []
+
+    # One lazily-read lcalc stream per d, shared by the first-zero probe and the verification
+    if stream is None:
+        stream = ZeroStream(d, config.lcalc_path, cache=cache)
+
+    with stream:
+        # Determine height η: user input or based on first zero + padding
+        eta: float
+        if config.eta is not None:
+            eta = config.eta
+        else:
+            try:
+                first_zero = float(stream[0])
+                eta = first_zero + 2 * config.eps     # Padding so that η is larger than the upper interval bound
+            except Exception as err:
+                raise RuntimeError(f"Fail to compute the first zero ordinate to use at height eta for GRH verification") from err
+
+        # Higher power: same stream, store and Λ table, k-th derivative of log L
+        if config.k != 1:
+            success, eta, N_used = higher_power_verify(
+                d=d,
+                k=config.k,
+                K=config.K,
+                eta=eta,
+                eps=config.eps,
+                lcalc_path=config.lcalc_path,
+                data_dir=config.data_dir,
+                log_path=config.log_path,
+                delta=config.delta,
+                backend=config.backend,
+                lambda_arr=lambda_arr,
+                zero_stream=stream,
+                store=store,
+                error_log=errors,
+                arena=arena
+            )
+            return d, success, eta, N_used, metrics.snapshot(), "".join(errors) or None
+
+        # Call the base case verification function
+        success, eta, N_used = base_case_verify(
+            d=d,
+            K=config.K,
+            eta=eta,
+            eps=config.eps,
+            lcalc_path=config.lcalc_path,
+            data_dir=config.data_dir,
+            log_path=config.log_path,
+            backend=config.backend,
+            lambda_arr=lambda_arr,
+            zero_stream=stream,
+            store=store,
+            K_start=config.K_start,
+            log_derivative=log_derivative,
+            error_log=errors,
+            arena=arena
+        )
+    return d, success, eta, N_used, metrics.snapshot(), "".join(errors) or None
+
+
+def verify_discriminant_targets(d: int, config: SweepConfig, lambda_arr: np.ndarray, stream: Optional[ZeroStream] = None, store: Optional[StoreWriter] = None, cache: Optional[ZeroCache] = None, log_derivative=None, arena: Optional[ScratchArena] = None) -> List[Result]:
+    """
+    Purpose:
+        Run the base case verification of one fundamental discriminant for every (eta, eps) of config.targets
+    Input:
+        As verify_discriminant
+    Return:
+        One (d, success, eta, N_used, metrics snapshot, error lines or None) per target, in target order; the
+        metrics snapshot and error lines of d travel with the first
+    """
+    metrics = run_metrics.begin()
+    errors: List[str] = []
+    if stream is None:
+        stream = ZeroStream(d, config.lcalc_path, cache=cache)
+
+    with stream:
+        # Automatic heights come from the first zero of the shared stream
+        targets = []
+        for eta, eps in config.targets:
+            if eta is None:
+                try:
+                    eta = float(stream[0]) + 2 * eps
+                except Exception as err:
+                    raise RuntimeError(f"Fail to compute the first zero ordinate to use at height eta for GRH verification") from err
+            targets.append((eta, eps))
+
+        outcomes = base_case_verify_targets(
+            d=d,
+            K=config.K,
+            targets=targets,
+            lcalc_path=config.lcalc_path,
+            data_dir=config.data_dir,
+            log_path=config.log_path,
+            backend=config.backend,
+            lambda_arr=lambda_arr,
+            zero_stream=stream,
+            store=store,
+            log_derivative=log_derivative,
+            error_log=errors,
+            arena=arena
+        )
+
+    results: List[Result] = [(d, success, eta, N_used, {}, None) for success, eta, _, N_used in outcomes]
+    results[0] = results[0][:4] + (metrics.snapshot(), "".join(errors) or None)
+    return results
+
+
+def _prefetch_count(d: int, config: SweepConfig, stream: ZeroStream, log_derivative) -> int:
+    # Zeros the verification of d will ask for, when its RHS is already known (base case with range series)
+    if config.k != 1 or log_derivative is None:
+        return 1
+    rhs = rhs_constant(d) + log_derivative
+    targets = config.targets or ((config.eta, config.eps),)
+    etas = [eta if eta is not None else float(stream[0]) + 2 * eps for eta, eps in targets]
+    return predicted_zero_count(d, float(rhs - 2 * iota(mp.mpf(max(etas)))))
+
+
+def prefetched_streams(ds: List[int], config: SweepConfig, series: Dict[int, object], fetcher: Optional[ZeroBatchFetcher] = None, cache: Optional[ZeroCache] = None) -> Iterator[Tuple[int, ZeroStream, Dict[str, float]]]:
+    """
+    Purpose:
+        Open and fill the zero stream of each d in a background thread, at most config.prefetch discriminants
+        ahead of the consumer
+    Input:
+        ds (List[int]): Discriminants, in the order they will be verified
+        config (SweepConfig): Sweep parameters
+        series (Dict[int, mp.mpf]): L'/L(2, χ_d) from the range engine (sizes each request; may be empty)
+        fetcher (Optional[ZeroBatchFetcher]): Batched source of the leading zeros, used by the thread only
+        cache (Optional[ZeroCache]): Zero cache seeding new streams
+    Return:
+        Iterator of (d, stream, metrics snapshot of the prefetch work for d)
+    """
+    ready: queue.Queue = queue.Queue(maxsize=max(1, config.prefetch))
+    stop = threading.Event()
+    done = object()
+
+    def put(item) -> bool:
+        # Blocking put that gives up once the consumer has stopped
+        while not stop.is_set():
+            try:
+                ready.put(item, timeout=0.1)
+                return True
+            except queue.Full:
+                continue
+        return False
+
+    def produce() -> None:
+        try:
+            for d in ds:
+                metrics = run_metrics.begin()          # This thread's own collector
+                stream = fetcher.stream(d) if fetcher is not None else ZeroStream(d, config.lcalc_path, cache=cache)
+                try:
+                    stream.take(_prefetch_count(d, config, stream, series.get(d)))
+                except Exception:
+                    pass        # The verification meets the same failure and reports it for d
+                if not put((d, stream, metrics.snapshot())):
+                    stream.close()
+                    return
+            put(done)
+        except BaseException as err:
+            put(err)
+
+    worker = threading.Thread(target=produce, name="zero-prefetch", daemon=True)
+    worker.start()
+    try:
+        while True:
+            item = ready.get()
+            if item is done:
+                return
+            if isinstance(item, BaseException):
+                raise item
+            yield item
+    finally:
+        # Consumer finished or failed: stop the thread and release the streams it still holds
+        stop.set()
+        worker.join()
+        while not ready.empty():
+            item = ready.get_nowait()
+            if isinstance(item, tuple):
+                item[1].close()
+
+
+def verify_block(block: Block, config: SweepConfig, lambda_arr: np.ndarray, skip: AbstractSet[int] = frozenset()) -> List[Result]:
+    """
+    Purpose:
+        Verify every fundamental discriminant in one block, with batched zero prefetching if enabled
+    Input:
+        block (Block): Inclusive range [lo, hi]
+        config (SweepConfig): Sweep parameters
+        lambda_arr (np.ndarray): Shared Λ table for K
+        skip (AbstractSet[int]): Discriminants of the block already verified by an earlier run
+    Return:
+        List of results in increasing d
+    """
+    lo, hi = block
+    arena = process_arena(config.K)
+    cache = ZeroCache(config.data_dir) if config.zero_cache else None
+    fetcher = None
+    if config.batch_zeros > 0 and lo != hi:
+        fetcher = ZeroBatchFetcher(config.lcalc_path, config.batch_zeros, width=config.batch_width, d_max=hi, cache=cache)
+
+    # RHS series of the whole block from shared residue tables (native fixed-K runs only)
+    series = {}
+    series_time = 0.0
+    if config.k == 1 and config.backend != "arb" and config.K_start is None and resolve_backend(config.backend) == "native":
+        start = time.perf_counter()
+        series = logarithmic_derivative_range(lo, hi, config.K, lambda_arr=lambda_arr)
+        series_time = time.perf_counter() - start
+
+    # One store file per block instead of one directory and three text files per d
+    store = StoreWriter(config.data_dir, lo, hi, config.K, config.store_eps) if config.data_format == "store" else None
+
+    # Non-fundamental discriminants never appear; skip those completed by an earlier run
+    ds = [int(d) for d in fundamental_discriminant_segment(lo, hi) if int(d) not in skip]
+    if config.prefetch > 0:
+        streams = prefetched_streams(ds, config, series, fetcher, cache)
+    else:
+        streams = ((d, fetcher.stream(d) if fetcher is not None else None, None) for d in ds)
+
+    results: List[Result] = []
+    for d, stream, prefetch_metrics in streams:
+        if config.targets:
+            outcome = verify_discriminant_targets(d, config, lambda_arr, stream, store, cache, series.get(d), arena)
+        else:
+            outcome = [verify_discriminant(d, config, lambda_arr, stream, store, cache, series.get(d), arena)]
+
+        # lcalc work done ahead by the prefetch thread belongs to d as well
+        if prefetch_metrics is not None:
+            run_metrics.combine(outcome[0][4], prefetch_metrics)
+        results += outcome
+
+    write_time = 0.0
+    if store is not None:
+        start = time.perf_counter()
+        store.close()
+        write_time = time.perf_counter() - start
+
+    # Share the per-block stages out over the block's discriminants (extra target rows carry no snapshot)
+    snapshots = [snapshot for *_, snapshot, _ in results if snapshot]
+    for snapshot in snapshots:
+        snapshot["t_series"] += series_time / len(snapshots)
+        snapshot["t_write"]  += write_time / len(snapshots)
+    return results
+
+# =========================== WORKER POOL ===========================
+
+_process_arena: Optional[ScratchArena] = None
+
+
+def process_arena(K: int) -> ScratchArena:
+    """Scratch arena of this process, created on first use for truncation K and grown when a later K is larger"""
+    global _process_arena
+    if _process_arena is None:
+        _process_arena = ScratchArena(K, ZERO_CAP)
+    elif len(_process_arena.chi) <= K:
+        _process_arena.chi_table(K)
+    return _process_arena
+
+
+_worker_config: Optional[SweepConfig] = None
+_worker_lambda: Optional[np.ndarray] = None
+
+
+def _worker_init(config: SweepConfig) -> None:
+    # Per-process state: the sweep parameters and the memory-mapped Λ table
+    global _worker_config, _worker_lambda
+    _worker_config = config
+    _worker_lambda = lambda_table(config.K, config.data_dir)
+
+
+def _worker_run(task: Tuple[Block, FrozenSet[int]]) -> List[Result]:
+    block, skip = task
+    return verify_block(block, _worker_config, _worker_lambda, skip)
+
+
+def _tasks(blocks: Iterable[Block], completed: AbstractSet[int]) -> Iterator[Tuple[Block, FrozenSet[int]]]:
+    # Pair each block with its already-completed discriminants; drop blocks that are fully done
+    for lo, hi in blocks:
+        if not completed:
+            yield (lo, hi), frozenset()
+            continue
+        skip = frozenset(d for d in range(lo, hi + 1) if d in completed)
+        if len(skip) < hi - lo + 1:
+            yield (lo, hi), skip
+
+
+def run_sweep(blocks: Iterable[Block], config: SweepConfig, jobs: int = 1, completed: AbstractSet[int] = frozenset()) -> Iterator[Result]:
+    """
+    Purpose:
+        Verify all blocks, serially (jobs = 1) or on a pool of jobs worker processes
+    Input:
+        blocks: Blocks to verify
+        config (SweepConfig): Sweep parameters
+        jobs (int): Number of worker processes
+        completed (AbstractSet[int]): Discriminants to skip (resume mode)
+    Return:
+        Iterator of (d, success, eta, N_used, metrics, error), in block completion order
+    """
+    if jobs < 1:
+        raise ValueError("jobs must be a positive integer")
+
+    # Write the shared Λ file once before any worker maps it
+    lambda_arr = lambda_table(config.K, config.data_dir)
+
+    if jobs == 1:
+        for block, skip in _tasks(blocks, completed):
+            yield from verify_block(block, config, lambda_arr, skip)
+        return
+
+    # chunksize=1: idle workers pull the next block, which balances uneven per-block cost
+    with mp_proc.Pool(jobs, initializer=_worker_init, initargs=(config,)) as pool:
+        for results in pool.imap_unordered(_worker_run, _tasks(blocks, completed), chunksize=1):
+            yield from results
@@ -0,0 +1,154 @@
+"""
+screening.py
+
+RHS-only screening pass: classify a whole range of discriminants before any lcalc work
+
+Functions:
+    - screen_block(lo, hi, K, eta, ...): rhs, margin rhs - 2 iota(eta) and predicted zero count for each fundamental d in [lo, hi]
+    - screen_blocks(blocks, K, eta, ...): screen_block over many blocks, skipping completed discriminants
+    - cost_order(blocks, rows): Blocks sorted by decreasing predicted lcalc cost
+    - write_screen(path, rows): Write the screening table as CSV
+    - screen_report(rows): Summary lines (zero-free share, predicted zeros, most expensive d)
+
+Classes:
+    - ScreenRow: (d, rhs, margin, predicted) for one discriminant
+
+Notes
+-----
+- A d with margin < 0 already satisfies 2 iota(eta) > rhs: base_case_verify would return N_needed = 0
+  without a zero, so its result is known from the screen and it never reaches the verification
+- predicted is predicted_zero_count(d, margin), the size of the first lcalc request of base_case_verify;
+  ordering blocks by its sum hands the expensive blocks out first, so with the shared work queue they
+  spread over the workers instead of one straggler finishing the sweep
+- rhs uses the same series values as the verification (range engine on the native backend, else
+  logarithmic_derivative_batch), so the margin test agrees with base_case_verify's
+"""
+
+import bisect
+import csv
+from pathlib import Path
+from typing import AbstractSet, Iterable, List, NamedTuple, Optional, Sequence, Tuple
+
+import numpy as np
+
+from .base_case import iota_lower, logarithmic_derivative_batch, predicted_zero_count, rhs_constant
+from .native import resolve_backend
+from .range_engine import logarithmic_derivative_range
+from .utils.discriminant import fundamental_discriminant_segment
+from .utils.von_mangoldt import lambda_table
+
+SCREEN_HEADER = ("d", "rhs", "margin", "predicted_zeros")
+
+
+class ScreenRow(NamedTuple):
+    d:         int
+    rhs:       float
+    margin:    float        # rhs - 2 iota(eta); negative: verified without zeros
+    predicted: int          # Predicted zero count (0 if margin < 0)
+
+
+def screen_block(lo: int, hi: int, K: int, eta: float, lambda_arr: Optional[np.ndarray] = None, backend: str = "auto", skip: AbstractSet[int] = frozenset()) -> List[ScreenRow]:
+    """
+    Purpose:
+        Compute the RHS and the margin of the base-case inequality for every fundamental d of [lo, hi]
+    Input:
+        lo, hi (int): Inclusive range
+        K (int): Truncation of the L'/L series
+        eta (float): Height η
+        lambda_arr (Optional[np.ndarray]): Λ(k) for k = 0..K (default: lambda_table(K))
+        backend (str): "auto" | "native" | "mpmath"
+        skip (AbstractSet[int]): Discriminants left out (e.g. completed by an earlier run)
+    Return:
+        List of ScreenRow in increasing d
+    """
+    if lambda_arr is None:
+        lambda_arr = lambda_table(K)
+    ds = [int(d) for d in fundamental_discriminant_segment(lo, hi) if int(d) not in skip]
+    if not ds:
+        return []
+
+    if resolve_backend(backend) == "native":
+        series = logarithmic_derivative_range(ds[0], ds[-1], K, lambda_arr=lambda_arr)
+        values = [series[d] for d in ds]
+    else:
+        values = logarithmic_derivative_batch(ds, K, lambda_arr=lambda_arr, backend=backend)
+
+    lhs0 = 2 * iota_lower([eta], backend=backend)[0]
+    rows = []
+    for d, log_derivative in zip(ds, values):
+        rhs = rhs_constant(d) + log_derivative
+        margin = rhs - lhs0
+        predicted = 0 if lhs0 > rhs else predicted_zero_count(d, float(margin))
+        rows.append(ScreenRow(d, float(rhs), float(margin), predicted))
+    return rows
+
+
+def screen_blocks(blocks: Iterable[Tuple[int, int]], K: int, eta: float, lambda_arr: Optional[np.ndarray] = None, backend: str = "auto", skip: AbstractSet[int] = frozenset()) -> List[ScreenRow]:
+    """
+    Purpose:
+        screen_block over every block
+    Input:
+        blocks (Iterable[Tuple[int, int]]): Inclusive ranges
+        K, eta, lambda_arr, backend, skip: As in screen_block
+    Return:
+        List of ScreenRow, block by block
+    """
+    if lambda_arr is None:
+        lambda_arr = lambda_table(K)
+    rows: List[ScreenRow] = []
+    for lo, hi in blocks:
+        rows += screen_block(lo, hi, K, eta, lambda_arr, backend, skip)
+    return rows
+
+
+def cost_order(blocks: Sequence[Tuple[int, int]], rows: Sequence[ScreenRow]) -> List[Tuple[int, int]]:
+    """
+    Purpose:
+        Longest-first order of the blocks by total predicted zeros (ties keep their range order)
+    Input:
+        blocks (Sequence[Tuple[int, int]]): Inclusive ranges
+        rows (Sequence[ScreenRow]): Screening rows of those blocks
+    Return:
+        Blocks in decreasing predicted cost; blocks without any d needing zeros are dropped
+    """
+    # Blocks are disjoint: the block of d is the last one starting at or below it
+    by_start = sorted(blocks)
+    starts = [lo for lo, _ in by_start]
+    cost = dict.fromkeys(by_start, 0)
+    for row in rows:
+        cost[by_start[bisect.bisect_right(starts, row.d) - 1]] += row.predicted
+    return sorted((block for block in blocks if cost[block] > 0), key=lambda block: -cost[block])
+
+
+def write_screen(path: str | Path, rows: Sequence[ScreenRow]) -> None:
+    """
+    Purpose:
+        Write the screening table (one write)
+    Input:
+        path (str | Path): Output CSV
+        rows (Sequence[ScreenRow]): Screening rows
+    """
+    with open(Path(path).expanduser(), "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(SCREEN_HEADER)
+        writer.writerows(rows)
+
+
+def screen_report(rows: Sequence[ScreenRow]) -> List[str]:
+    """
+    Purpose:
+        Human-readable summary of a screen
+    Input:
+        rows (Sequence[ScreenRow]): Screening rows
+    Return:
+        List of report lines
+    """
+    if not rows:
+        return ["Screen: no discriminants"]
+    free = sum(1 for row in rows if row.predicted == 0)
+    predicted = np.array([row.predicted for row in rows if row.predicted > 0], dtype=np.int64)
+    lines = [f"Screen over {len(rows)} discriminants: {free} ({100 * free / len(rows):.1f} %) need no zeros"]
+    if len(predicted):
+        worst = max(rows, key=lambda row: row.predicted)
+        lines.append(f"  predicted zeros   total {int(predicted.sum())}   median {int(np.median(predicted))}   max {worst.predicted} (d = {worst.d})")
+    return lines
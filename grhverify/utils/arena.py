@@ -0,0 +1,61 @@
+"""
+arena.py
+
+Reusable per-worker scratch buffers for the per-discriminant hot path
+
+Classes:
+    - ScratchArena(K, max_zeros): χ_d table and zero-prefix buffer sized once from K and the largest expected
+      zero count, handed out as views and overwritten by the next discriminant
+
+Notes
+-----
+- Without an arena every d allocates a fresh (K + 1) int8 χ array and one float64 prefix array per zero
+  request; over 10^6 discriminants that is pure allocator churn, and fragmentation grows a long-lived
+  worker's RSS. With one arena per worker, peak scratch memory is fixed by K and max_zeros, not by the
+  number of discriminants swept
+- Views are valid until the next discriminant starts (reset()); nothing returned to the caller (outcomes,
+  store records, cached zeros) points into the arena
+- Buffers only grow, by doubling, when a request exceeds the initial size (e.g. a d needing more zeros
+  than max_zeros); they are never shrunk or zeroed between discriminants
+- One arena per process: worker pools are process-based, and threads must not share one
+"""
+
+import numpy as np
+
+
+class ScratchArena:
+    """
+    Purpose:
+        Per-worker scratch memory reused across discriminants
+    Input:
+        K (int): Truncation of the sweep (size of the χ table)
+        max_zeros (int): Largest zero count expected per request (size of the prefix buffer)
+    """
+
+    __slots__ = ("chi", "prefix", "resets")
+
+    def __init__(self, K: int, max_zeros: int) -> None:
+        self.chi    = np.empty(K + 1, dtype=np.int8)
+        self.prefix = np.empty(max(1, max_zeros), dtype=np.float64)
+        self.resets = 0
+
+    def reset(self) -> None:
+        """Start a new discriminant: every view handed out so far may be overwritten"""
+        self.resets += 1
+
+    def chi_table(self, K: int) -> np.ndarray:
+        """Writable int8 view for χ_d(k), k = 0..K"""
+        if len(self.chi) <= K:
+            self.chi = np.empty(max(K + 1, 2 * len(self.chi)), dtype=np.int8)
+        return self.chi[:K + 1]
+
+    def prefix_table(self, n: int) -> np.ndarray:
+        """Writable float64 view for n prefix sums"""
+        if len(self.prefix) < n:
+            self.prefix = np.empty(max(n, 2 * len(self.prefix)), dtype=np.float64)
+        return self.prefix[:n]
+
+    @property
+    def nbytes(self) -> int:
+        """Scratch memory held"""
+        return self.chi.nbytes + self.prefix.nbytes
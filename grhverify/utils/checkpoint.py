@@ -0,0 +1,118 @@
+"""
+checkpoint.py
+
+Progress tracking for long sweeps, so an interrupted run can resume where it stopped
+
+Classes:
+    - CheckpointJournal(path): Append-only binary journal of completed discriminants (one little-endian int64 each)
+
+Functions:
+    - completed_from_summary(summary_path): Set of discriminants already present in an existing summary.csv
+
+Notes
+-----
+- Each journal record is a single 8-byte write on an O_APPEND descriptor, which the OS applies atomically,
+  so several processes (shards sharing an output directory) can append to the same journal
+- record_many() packs a batch of records into one O_APPEND write, appended as a unit like a single record
+- A record torn by a crash (file length not a multiple of 8) is ignored when loading
+- Resuming skips by d only: it assumes the rerun uses the same eta / K / eps as the interrupted one
+"""
+
+import os
+import csv
+import struct
+from pathlib import Path
+from typing import Iterable, Set
+
+RECORD = struct.Struct("<q")
+
+
+def completed_from_summary(summary_path: str | Path) -> Set[int]:
+    """
+    Purpose:
+        Collect the discriminants that already have a row in summary.csv
+    Input:
+        summary_path (str | Path): Path to the summary CSV (missing file means nothing completed)
+    Return:
+        Set of completed discriminants
+    """
+    path = Path(summary_path).expanduser()
+    done: Set[int] = set()
+    if not path.is_file():
+        return done
+
+    with open(path, newline="") as f:
+        text = f.read()
+
+    # A crash can leave a partial last row without its newline: drop it
+    if text and not text.endswith("\n"):
+        text = text[:text.rfind("\n") + 1]
+
+    for row in csv.reader(text.splitlines()):
+        try:
+            done.add(int(row[0]))
+        except (ValueError, IndexError):
+            continue        # header or malformed row
+    return done
+
+
+class CheckpointJournal:
+    """
+    Purpose:
+        Binary journal of completed discriminants, cheap to append and to reload
+    Input:
+        path (str | Path): Journal file (created on first record)
+    """
+
+    def __init__(self, path: str | Path) -> None:
+        self.path = Path(path).expanduser()
+        self._fd = None
+
+    def load(self) -> Set[int]:
+        """
+        Purpose:
+            Read every complete record of the journal
+        Return:
+            Set of journaled discriminants
+        """
+        if not self.path.is_file():
+            return set()
+        data = self.path.read_bytes()
+        usable = len(data) - len(data) % RECORD.size
+        return {d for (d,) in RECORD.iter_unpack(data[:usable])}
+
+    def record(self, d: int) -> None:
+        """
+        Purpose:
+            Append one completed discriminant
+        Input:
+            d (int): Discriminant whose summary row has been written
+        """
+        self.record_many((d,))
+
+    def record_many(self, ds: Iterable[int]) -> None:
+        """
+        Purpose:
+            Append a batch of completed discriminants with a single write
+        Input:
+            ds (Iterable[int]): Discriminants whose summary rows have been written
+        """
+        data = b"".join(RECORD.pack(d) for d in ds)
+        if not data:
+            return
+        if self._fd is None:
+            self.path.parent.mkdir(parents=True, exist_ok=True)
+            self._fd = os.open(self.path, os.O_WRONLY | os.O_CREAT | os.O_APPEND, 0o644)
+        os.write(self._fd, data)
+
+    def close(self) -> None:
+        """Close the journal descriptor"""
+        if self._fd is not None:
+            os.close(self._fd)
+            self._fd = None
+
+    def __enter__(self) -> "CheckpointJournal":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
@@ -0,0 +1,238 @@
+"""
+data_store.py
+
+Chunked, columnar, memory-mappable store for per-discriminant results, replacing the per-d text files
+(zeros.txt, intervals.txt, kronecker.txt) and per-d directories under data/
+
+Classes:
+    - StoreWriter(data_dir, lo, hi, K, eps): Collect the records of one d-range and write them as one file
+    - StoreReader(path): Memory-map one store file; look up zeros / intervals per d without parsing
+    - DataStore(data_dir): All store files under data_dir/store, with lookup by d
+
+Notes
+-----
+File layout (little-endian), one file data/store/block_{lo}_{hi}.grh per d-range:
+    header   64 bytes   magic b"GRHSTORE", version u32, n_records u32, K u64, eps f64, lo i64, hi i64, 16 reserved
+    index    n_records * INDEX_DTYPE (sorted by d): d, offset into the zeros column, zero count, N_used, eta, success
+    zeros    float64 column of every zero ordinate used, concatenated in index order
+
+- Intervals are not stored: they are [gamma - eps, gamma + eps] with eps from the header
+- χ_d is not stored: compute_kronecker regenerates it in microseconds with the native kernel
+- Files are written to a temporary name and renamed, so readers never see a partial file
+- Rewriting an existing block file (e.g. a resumed, partially completed block) keeps its records for the
+  discriminants not recomputed, but only if it was written with the same K and eps: a run with other
+  parameters writes block_{lo}_{hi}_K{K}_eps{eps}.grh instead, so earlier results are never relabelled
+"""
+
+import os
+import numpy as np
+from pathlib import Path
+from typing import Dict, List, Optional
+
+STORE_MAGIC   = b"GRHSTORE"
+STORE_VERSION = 1
+HEADER_SIZE   = 64
+
+INDEX_DTYPE = np.dtype([
+    ("d",       "<i8"),
+    ("offset",  "<i8"),
+    ("count",   "<i4"),
+    ("N_used",  "<i4"),
+    ("eta",     "<f8"),
+    ("success", "u1"),
+    ("_pad",    "V7"),
+])
+
+HEADER_DTYPE = np.dtype([
+    ("magic",     "S8"),
+    ("version",   "<u4"),
+    ("n_records", "<u4"),
+    ("K",         "<u8"),
+    ("eps",       "<f8"),
+    ("lo",        "<i8"),
+    ("hi",        "<i8"),
+    ("_reserved", "V16"),
+])
+
+
+def store_path(data_dir: str | Path, lo: int, hi: int, K: Optional[int] = None, eps: Optional[float] = None) -> Path:
+    """Path of the store file covering [lo, hi]; with K and eps, the file of a run whose parameters differ from the block file's"""
+    name = f"block_{lo}_{hi}" if K is None else f"block_{lo}_{hi}_K{K}_eps{eps!r}"
+    return Path(data_dir).expanduser() / "store" / f"{name}.grh"
+
+
+class StoreWriter:
+    """
+    Purpose:
+        Accumulate per-discriminant records for the d-range [lo, hi] and write them as one file
+    Input:
+        data_dir (str | Path): Data directory (files go to data_dir/store)
+        lo (int), hi (int): Inclusive d-range covered by the file
+        K (int): Truncation parameter of the run
+        eps (float): Interval half-width of the run
+    """
+
+    def __init__(self, data_dir: str | Path, lo: int, hi: int, K: int, eps: float) -> None:
+        self.path = store_path(data_dir, lo, hi)
+        self.data_dir = data_dir
+        self.lo, self.hi, self.K, self.eps = lo, hi, K, eps
+        self._records: List[tuple] = []
+        self._zeros: List[np.ndarray] = []
+        self._offset = 0
+
+    def add(self, d: int, zeros: np.ndarray, eta: float, N_used: int, success: bool) -> None:
+        """
+        Purpose:
+            Record the zeros used for d and its verification outcome
+        Input:
+            d (int): Discriminant in [lo, hi]
+            zeros: Zero ordinates computed for d (float64); the first N_used were used
+            eta (float), N_used (int), success (bool): Verification outcome
+        """
+        if not (self.lo <= d <= self.hi):
+            raise ValueError(f"d = {d} outside the store range [{self.lo}, {self.hi}]")
+        zeros = np.ascontiguousarray(zeros, dtype="<f8")
+        self._records.append((d, self._offset, len(zeros), N_used, eta, int(bool(success))))
+        self._zeros.append(zeros)
+        self._offset += len(zeros)
+
+    def close(self) -> Optional[Path]:
+        """
+        Purpose:
+            Write the file (atomically); does nothing if no record was added
+        Return:
+            Path written, or None
+        """
+        if not self._records:
+            return None
+
+        # An earlier file for this block written with other K / eps stays as it is: this run gets its own file
+        if self.path.is_file():
+            previous = StoreReader(self.path)
+            same_run = (previous.K, previous.eps) == (self.K, self.eps)
+            del previous
+            if not same_run:
+                self.path = store_path(self.data_dir, self.lo, self.hi, self.K, self.eps)
+
+        # Carry over records of an earlier file of the same parameters that were not recomputed
+        if self.path.is_file():
+            previous = StoreReader(self.path)
+            fresh = {record[0] for record in self._records}
+            for entry in previous.index:
+                d = int(entry["d"])
+                if d not in fresh:
+                    self.add(d, np.array(previous.zeros(d)), float(entry["eta"]), int(entry["N_used"]), bool(entry["success"]))
+            del previous
+
+        index = np.zeros(len(self._records), dtype=INDEX_DTYPE)
+        for field, column in zip(("d", "offset", "count", "N_used", "eta", "success"), zip(*self._records)):
+            index[field] = column
+        order = np.argsort(index["d"], kind="stable")
+        index = index[order]
+
+        header = np.zeros(1, dtype=HEADER_DTYPE)
+        for field, value in (("magic", STORE_MAGIC), ("version", STORE_VERSION), ("n_records", len(index)),
+                             ("K", self.K), ("eps", self.eps), ("lo", self.lo), ("hi", self.hi)):
+            header[field] = value
+
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        tmp_path = self.path.with_name(f"{self.path.name}.{os.getpid()}.tmp")
+        with open(tmp_path, "wb") as f:
+            f.write(header.tobytes())
+            f.write(index.tobytes())
+            for zeros in self._zeros:
+                f.write(zeros.tobytes())
+        os.replace(tmp_path, self.path)
+
+        self._records, self._zeros, self._offset = [], [], 0
+        return self.path
+
+    def __enter__(self) -> "StoreWriter":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+
+class StoreReader:
+    """
+    Purpose:
+        Read-only, memory-mapped view of one store file
+    Input:
+        path (str | Path): Store file
+    """
+
+    def __init__(self, path: str | Path) -> None:
+        self.path = Path(path).expanduser()
+        raw = np.memmap(self.path, dtype=np.uint8, mode="r")
+        if raw.size < HEADER_SIZE:
+            raise ValueError(f"{self.path} is not a store file")
+
+        header = raw[:HEADER_SIZE].view(HEADER_DTYPE)[0]
+        if bytes(header["magic"]) != STORE_MAGIC or int(header["version"]) != STORE_VERSION:
+            raise ValueError(f"{self.path} is not a version-{STORE_VERSION} store file")
+
+        n = int(header["n_records"])
+        index_end = HEADER_SIZE + n * INDEX_DTYPE.itemsize
+        self.K   = int(header["K"])
+        self.eps = float(header["eps"])
+        self.lo  = int(header["lo"])
+        self.hi  = int(header["hi"])
+        self.index = raw[HEADER_SIZE:index_end].view(INDEX_DTYPE)
+        self._zeros = raw[index_end:].view("<f8")
+
+    def __contains__(self, d: int) -> bool:
+        return self._row(d) is not None
+
+    def _row(self, d: int) -> Optional[int]:
+        pos = int(np.searchsorted(self.index["d"], d))
+        if pos < len(self.index) and int(self.index["d"][pos]) == d:
+            return pos
+        return None
+
+    def record(self, d: int) -> Optional[Dict[str, object]]:
+        """Verification outcome of d (eta, N_used, success), or None if absent"""
+        row = self._row(d)
+        if row is None:
+            return None
+        entry = self.index[row]
+        return {"d": d, "eta": float(entry["eta"]), "N_used": int(entry["N_used"]), "success": bool(entry["success"])}
+
+    def zeros(self, d: int) -> np.ndarray:
+        """Zero ordinates stored for d, as a read-only view into the mapping (empty if absent)"""
+        row = self._row(d)
+        if row is None:
+            return self._zeros[:0]
+        entry = self.index[row]
+        start = int(entry["offset"])
+        return self._zeros[start:start + int(entry["count"])]
+
+    def intervals(self, d: int) -> np.ndarray:
+        """(N, 2) intervals [gamma - eps, gamma + eps] derived from the stored zeros"""
+        zeros = self.zeros(d)
+        return np.column_stack((zeros - self.eps, zeros + self.eps))
+
+
+class DataStore:
+    """
+    Purpose:
+        Lookup by d across every store file under data_dir/store
+    Input:
+        data_dir (str | Path): Data directory
+    """
+
+    def __init__(self, data_dir: str | Path) -> None:
+        root = Path(data_dir).expanduser() / "store"
+        self.readers: List[StoreReader] = [StoreReader(p) for p in sorted(root.glob("block_*.grh"))] if root.is_dir() else []
+
+    def reader_for(self, d: int) -> Optional[StoreReader]:
+        """Store file holding d (the most recently modified one if several cover it)"""
+        found = [r for r in self.readers if r.lo <= d <= r.hi and d in r]
+        if not found:
+            return None
+        return max(found, key=lambda r: r.path.stat().st_mtime)
+
+    def zeros(self, d: int) -> np.ndarray:
+        """Stored zeros for d (empty array if none)"""
+        reader = self.reader_for(d)
+        return reader.zeros(d) if reader is not None else np.zeros(0)
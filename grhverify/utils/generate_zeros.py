@@ -5,37 +5,76 @@ Functions to fetch and store the nontrivial zeros of quadratic Dirichlet L-funct
 via the lcalc command-line tool, and for building small symmetric intervals around each zeros
 
 Functions:
-    - compute_zeros(d, N, lcalc_path): Use lcalc to compute the first N positive ordinates (imaginary parts) of the nontrivial zeros of L(s, χ_d)
+    - lcalc_command(d, N, lcalc_path): Build the lcalc command line computing the first N zeros of L(s, χ_d)
+    - parse_zero_line(line): Parse one line of lcalc output into an ordinate (None for headers/footers)
+    - compute_zeros_range(d_min, d_max, N, lcalc_path): First N zeros of every twist d in [d_min, d_max] from one lcalc run
+    - resolve_engine(engine, d): Choose between the in-process lcalc library and the lcalc executable
+    - compute_zeros_array(d, N, lcalc_path, engine, cache, partial): First N ordinates as a contiguous float64 array
+    - compute_zeros(d, N, lcalc_path, engine, cache): Use lcalc to compute the first N positive ordinates (imaginary parts) of the nontrivial zeros of L(s, χ_d)
     - write_zeros(d, zeros, data_dir): Write the list of zero ordinates to data_dir/{positive_d|negative_d}/d_{d}/zeros.txt
-    - compute_intervals(d, N, eps, lcalc_path, zeros): Given either a precalculated list of zeros or by invoking compute_zeros, build an (N,2) numpy array of [gamma - eps, gamma + eps] rows
+    - compute_intervals(d, N, eps, lcalc_path, zeros, cache): Given either a precalculated list of zeros or by invoking compute_zeros, build an (N,2) numpy array of [gamma - eps, gamma + eps] rows
     - write_intervals(d, intervals, data_dir): Write the array of intervals to data_dir/{positive_d|negative_d}/d_{d}/intervals.txt
 
 Notes
 -----
 - Path to lcalc executable must be provided inside the config.json file
+- If the native extension was built against lcalc (GRH_LCALC_PREFIX), zeros are computed in-process by default
 - Work for any discriminant d; however, if d is not fundamental, lcalc will return nothing
+- With a ZeroCache (zero_cache.py), cached prefixes are served without calling lcalc and new lists are recorded
 """
 
 import subprocess
 import numpy as np
 from pathlib import Path
-from typing import List, Optional
+from typing import Dict, List, Optional
 
+from ..native import _native, LCALC_LINKED
+from .zero_cache import ZeroCache
 
-def compute_zeros(d: int, N: int, lcalc_path: str | Path) -> List[float]:
+ENGINES = ("auto", "library", "subprocess")
+
+
+def resolve_engine(engine: str, d: int) -> str:
     """
     Purpose:
-        Retrieve the first N positive ordinates of the Dirichlet L-function for χ_d
-    Input:  
+        Decide how zeros of L(s, χ_d) are computed
+    Input:
+        engine (str): "auto" (library if linked, else subprocess), "library", or "subprocess"
+        d (int): Discriminant (the library path needs |d| > 1)
+    Return:
+        "library" or "subprocess"
+    """
+    if engine not in ENGINES:
+        raise ValueError(f"engine must be one of {ENGINES}, got {engine!r}")
+    if engine == "library" and not LCALC_LINKED:
+        raise RuntimeError("lcalc library engine requested but the extension was built without GRH_LCALC_PREFIX")
+    if engine == "auto":
+        engine = "library" if LCALC_LINKED else "subprocess"
+    # ζ itself (d = ±1) is not a quadratic twist: leave it to the executable
+    if engine == "library" and abs(d) <= 1:
+        return "subprocess"
+    return engine
+
+
+def lcalc_command(d: int, N: int, lcalc_path: str | Path, d_finish: Optional[int] = None) -> List[str]:
+    """
+    Purpose:
+        Build the lcalc command line for the first N zeros of L(s, χ_d)
+    Input:
         d (int): Fundamental discriminant of the Dirichlet character χ_d
         N (int): Number of non-trivial zeros to compute
         lcalc_path (str | Path): Path to the lcalc executable
+        d_finish (Optional[int]): If given, twist every fundamental discriminant in [d, d_finish] in one run
     Return:
-        List[float] of the first N non-trivial zero ordinates
+        List[str] suitable for subprocess
     """
     # Input validation
     if not isinstance(d, int):
         raise TypeError("Discriminant d must be an integer")
+    if d_finish is None:
+        d_finish = d
+    if d_finish < d:
+        raise ValueError("d_finish must be greater than or equal to d")
     if not isinstance(N, int) or N <= 0:
         raise ValueError("N must be a positive integer")
 
@@ -46,19 +85,148 @@ def compute_zeros(d: int, N: int, lcalc_path: str | Path) -> List[float]:
 
     # Build the command to compute zeros
     cmd = [
-        lcalc_path,
+        str(exe),
         "-z", str(N),                   # Number of zeros to compute
     ]
 
     # For nontrivial discriminants (|d| != 1), twist by the quadratic character
-    if abs(d) != 1:
+    if abs(d) != 1 or d_finish != d:
         cmd.append("--twist-quadratic")
     
-    # Restrict to the single discriminant d
+    # Restrict to the discriminant d (or the range [d, d_finish])
     cmd += [
         "--start", str(d),              # Discriminant d
-        "--finish", str(d)
+        "--finish", str(d_finish)
     ]
+    return cmd
+
+
+def parse_zero_line(line: str) -> Optional[float]:
+    """
+    Purpose:
+        Parse one line of lcalc output
+    Input:
+        line (str): Raw output line
+    Return:
+        The ordinate (last token) as float, or None for header/footer/blank lines
+    """
+    try:
+        # Last token is expected to be the ordinate
+        return float(line.split()[-1])
+    except (ValueError, IndexError):
+        return None
+
+
+def compute_zeros_range(d_min: int, d_max: int, N: int, lcalc_path: str | Path) -> Dict[int, List[float]]:
+    """
+    Purpose:
+        Retrieve the first N positive ordinates for every quadratic twist d in [d_min, d_max] with a single
+        lcalc invocation, amortising its startup and precomputation over the whole interval
+    Input:
+        d_min (int), d_max (int): Inclusive discriminant range
+        N (int): Number of non-trivial zeros per discriminant
+        lcalc_path (str | Path): Path to the lcalc executable
+    Return:
+        Dict mapping each discriminant lcalc reported (the fundamental ones) to its first N ordinates
+    """
+    cmd = lcalc_command(d_min, N, lcalc_path, d_finish=d_max)
+
+    # Execute lcalc and capture stdout
+    try:
+        res = subprocess.run(
+            cmd,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            check=True,
+            text=True
+        )
+    except subprocess.CalledProcessError as err:
+        # Wrap and propagate any lcalc error
+        raise RuntimeError(
+            f"lcalc failed with status {err.returncode}\n"
+            f"stdout: {err.stdout}\nstderr: {err.stderr}"
+        ) from err
+
+    # Demultiplex "d gamma" lines by their leading discriminant
+    zeros: Dict[int, List[float]] = {}
+    for line in res.stdout.splitlines():
+        tokens = line.split()
+        if len(tokens) < 2:
+            continue
+        try:
+            d, gamma = int(tokens[0]), float(tokens[-1])
+        except ValueError:
+            continue        # header or footer line
+        zeros.setdefault(d, []).append(gamma)
+
+    return {d: gammas[:N] for d, gammas in zeros.items()}
+
+
+def compute_zeros_array(d: int, N: int, lcalc_path: Optional[str | Path] = None, engine: str = "auto", cache: Optional[ZeroCache] = None, partial: bool = False) -> np.ndarray:
+    """
+    Purpose:
+        Retrieve the first N positive ordinates as a contiguous float64 array
+        With the library engine the ordinates are written by lcalc directly into the array (no text round-trip)
+    Input:
+        d (int): Fundamental discriminant of the Dirichlet character χ_d
+        N (int): Number of non-trivial zeros to compute
+        lcalc_path (Optional[str | Path]): Path to the lcalc executable (only needed by the subprocess engine)
+        engine (str): "auto" | "library" | "subprocess"
+        cache (Optional[ZeroCache]): Zero cache consulted first and updated with the result
+        partial (bool): Library engine: return the zeros lcalc found when it finds fewer than N, instead of raising
+    Return:
+        np.ndarray of shape (N,), or shorter with partial=True
+    """
+    # Input validation
+    if not isinstance(d, int):
+        raise TypeError("Discriminant d must be an integer")
+    if not isinstance(N, int) or N <= 0:
+        raise ValueError("N must be a positive integer")
+
+    # Served from the cache without touching lcalc
+    if cache is not None:
+        cached = cache.get(d, count=N)
+        if cached is not None:
+            return np.array(cached)
+
+    if resolve_engine(engine, d) == "library":
+        zeros = np.empty(N, dtype=np.float64)
+        found = _native.lcalc_zeros(d, N, zeros)
+        if found < N and not partial:
+            raise RuntimeError(f"Expected {N} zeros but lcalc returned {found}")
+        zeros = zeros[:found]
+        if cache is not None:
+            cache.put(d, zeros)
+        return zeros
+
+    if lcalc_path is None:
+        raise ValueError("lcalc_path is required when the lcalc library is not linked")
+    return np.asarray(compute_zeros(d, N, lcalc_path, engine="subprocess", cache=cache), dtype=np.float64)
+
+
+def compute_zeros(d: int, N: int, lcalc_path: str | Path, engine: str = "auto", cache: Optional[ZeroCache] = None) -> List[float]:
+    """
+    Purpose:
+        Retrieve the first N positive ordinates of the Dirichlet L-function for χ_d
+    Input:  
+        d (int): Fundamental discriminant of the Dirichlet character χ_d
+        N (int): Number of non-trivial zeros to compute
+        lcalc_path (str | Path): Path to the lcalc executable
+        engine (str): "auto" | "library" | "subprocess" (see resolve_engine)
+        cache (Optional[ZeroCache]): Zero cache consulted first and updated with the result
+    Return:
+        List[float] of the first N non-trivial zero ordinates
+    """
+    # Served from the cache without touching lcalc
+    if cache is not None:
+        cached = cache.get(d, count=N)
+        if cached is not None:
+            return [float(z) for z in cached]
+
+    if resolve_engine(engine, d) == "library":
+        return compute_zeros_array(d, N, engine="library", cache=cache).tolist()
+
+    cmd = lcalc_command(d, N, lcalc_path)
 
     # Execute lcalc and capture stdout
     try:
@@ -76,15 +244,12 @@ def compute_zeros(d: int, N: int, lcalc_path: str | Path) -> List[float]:
             f"stdout: {err.stdout}\nstderr: {err.stderr}"
         ) from err
 
-    # Parse the output lines for floats
+    # Parse the output lines for floats, skipping any header or footer lines that don't parse
     zeros: list[float] = []
     for line in res.stdout.splitlines():
-        try:
-            # Last token is expected to be the ordinate
-            zeros.append(float(line.split()[-1]))
-        except ValueError:
-            # Skip any header or footer lines that don't parse
-            continue                   
+        gamma = parse_zero_line(line)
+        if gamma is not None:
+            zeros.append(gamma)
 
     # Ensure we got N zeros back
     if len(zeros) < N:
@@ -92,10 +257,14 @@ def compute_zeros(d: int, N: int, lcalc_path: str | Path) -> List[float]:
             f"Excepted {N} zeros but lcalc returned {len(zeros)}"
         )   
 
+    # Record the list so later runs (other eta / eps) reuse it
+    if cache is not None:
+        cache.put(d, zeros[:N])
+
     return zeros[:N]  # Return only the first N zeros
 
 
-def write_zeros(d: int, zeros: List[float], data_dir: str | Path) -> None:
+def write_zeros(d: int, zeros: List[float], data_dir: str | Path) -> int:
     """
     Purpose:
         Save the zeros ordinates to the zeros.txt file in the corresponding directory
@@ -104,7 +273,7 @@ def write_zeros(d: int, zeros: List[float], data_dir: str | Path) -> None:
         zeros (List[float]): List of zeros ordinates
         data_dir (str): Path to the data directory
     Return:
-        None
+        Number of bytes written
     """
     # Ensure the storing directory exists
     target = Path(data_dir).expanduser() / ("positive_d" if d > 0 else "negative_d") / f"d_{d}"
@@ -112,11 +281,13 @@ def write_zeros(d: int, zeros: List[float], data_dir: str | Path) -> None:
     
     # Save the zeros to the zeros.txt file 
     txt_path = target / "zeros.txt"
-    with open(txt_path, "w") as f:
-        f.writelines(f"{gamma}\n" for gamma in zeros)
+    text = "".join(f"{gamma}\n" for gamma in zeros).encode()
+    with open(txt_path, "wb") as f:
+        f.write(text)
+    return len(text)
 
 
-def compute_intervals(d: int, N: int, eps: float, lcalc_path: str, zeros: Optional[List[float]] = None) -> np.ndarray:
+def compute_intervals(d: int, N: int, eps: float, lcalc_path: str, zeros: Optional[List[float]] = None, cache: Optional[ZeroCache] = None) -> np.ndarray:
     """
     Purpose:
         Return an (N, 2) array of symmetric intervals [gamma - eps, gamma + eps] around zeros 
@@ -127,12 +298,13 @@ def compute_intervals(d: int, N: int, eps: float, lcalc_path: str, zeros: Option
         eps (float): Half-width of the interval around each zero
         lcalc_path (str): Path to the lcalc executable
         zeros (Optional[List[float]]): Precomputed zeros, if available
+        cache (Optional[ZeroCache]): Zero cache consulted before lcalc
 
     Output: Array of shape (N, 2), where each row is [gamma - eps, gamma + eps] (np.ndarray)
     """
     # If zeros are not provided or there are not enough, compute them
     if zeros is None or len(zeros) < N:
-        zeros = compute_zeros(d, N, lcalc_path)
+        zeros = compute_zeros(d, N, lcalc_path, cache=cache)
 
     # Convert zeros to a numpy array and ensure it has the correct type
     zeros = np.asarray(zeros[:N], dtype=float)
@@ -141,7 +313,7 @@ def compute_intervals(d: int, N: int, eps: float, lcalc_path: str, zeros: Option
     return np.column_stack((zeros - eps, zeros + eps))
 
 
-def write_intervals(d: int, intervals: np.ndarray, data_dir: str) -> None:
+def write_intervals(d: int, intervals: np.ndarray, data_dir: str) -> int:
     """
     Purpose:
         Save the intervals [gamma - eps, gamma + eps] to the intervals.txt file in the corresponding directory
@@ -150,7 +322,7 @@ def write_intervals(d: int, intervals: np.ndarray, data_dir: str) -> None:
         intervals (np.ndarray): Array of shape (N, 2) containing the intervals
         data_dir (str | Path): Path to the data directory
     Output: 
-        None
+        Number of bytes written
     """
     # Ensure the storing directory exists
     target = Path(data_dir).expanduser() / ("positive_d" if d > 0 else "negative_d") / f"d_{d}"
@@ -158,6 +330,7 @@ def write_intervals(d: int, intervals: np.ndarray, data_dir: str) -> None:
 
     # Save the intervals to the intervals.txt file
     txt_path = target / "intervals.txt"
-    with open(txt_path, "w") as f:
-        for gamma_minus, gamma_plus in intervals:
-            f.write(f"{gamma_minus} {gamma_plus}\n")
+    text = "".join(f"{gamma_minus} {gamma_plus}\n" for gamma_minus, gamma_plus in intervals).encode()
+    with open(txt_path, "wb") as f:
+        f.write(text)
+    return len(text)
@@ -4,21 +4,30 @@ kronecker_symbol.py
 Compute and persist the Kronecker symbol χ_n(d) for quadratic Dirichlet characters
 
 Functions:
-    - compute_kronecker(d, K): Build the character values χ_d(k) = (d|k) for k=1..K via Sage's kronecker_symbol function
+    - compute_kronecker(d, K, backend, out): Build the character values χ_d(k) = (d|k) for k=1..K, either with the native
+                                        sieve-based kernel or via Sage's kronecker_symbol function (reference path)
+    - kronecker_matrix(ds, ks): χ_d(k) for a block of discriminants at selected k, as a (len(ks), len(ds)) int8 matrix
     - write_kronecker(d, K, chi_arr, data_dir): Write the array of χ_d(k) values to a text file
 """
 
 import numpy as np
 from pathlib import Path
-from sage.all import kronecker_symbol
+from typing import Optional, Sequence
 
-def compute_kronecker(d: int, K: int) -> np.ndarray:
+from ..native import _native, resolve_backend
+
+def compute_kronecker(d: int, K: int, backend: str = "auto", out: Optional[np.ndarray] = None) -> np.ndarray:
     """
     Purpose:
         Compute the Kronecker symbol for integers k from [1..K] with respect to d
     Input:  
         d (int): Discriminant of Dirichlet character
         K (int): Upper bound of k
+        backend (str): "native": χ_d evaluated at primes only (binary Jacobi) and filled in over a shared
+                                 smallest-prime-factor sieve; releases the GIL so threads can run several d
+                       "mpmath": reference path, one Sage kronecker_symbol call per k
+                       "auto":   native if the extension is built
+        out (Optional[np.ndarray]): int8 buffer of K + 1 entries to fill instead of allocating (e.g. ScratchArena.chi_table)
     Return: 
         Array of shape (K + 1, ), where chi_arr[k] is the kronecker symbol of k and chi_arr[0] is unused (set to 0)
     """
@@ -26,14 +35,46 @@ def compute_kronecker(d: int, K: int) -> np.ndarray:
     if not (isinstance(K, int) and K >= 1):
         raise ValueError(f"The upper bound K must be a positive integer")
     
-    # Use SageMath to compute the Kronecker symbol of k = 1..K
-    chi_arr = np.zeros(K + 1, dtype=np.int8)
+    chi_arr = np.zeros(K + 1, dtype=np.int8) if out is None else out[:K + 1]
+    if resolve_backend(backend) == "native":
+        _native.kronecker_table(int(d), K, chi_arr)
+        chi_arr[0] = 0
+        return chi_arr
+
+    # Use SageMath to compute the Kronecker symbol of k = 1..K (imported lazily: Sage startup is slow)
+    from sage.all import kronecker_symbol
+    chi_arr[0] = 0
     for k in range(1, K + 1):
         chi_arr[k] = kronecker_symbol(d, k)
     return chi_arr
 
 
-def write_kronecker(d: int, K: int, chi_arr: np.ndarray, data_dir = str | Path) -> None:
+def kronecker_matrix(ds: Sequence[int], ks: np.ndarray, backend: str = "auto") -> np.ndarray:
+    """
+    Purpose:
+        Kronecker symbols χ_d(k) for a block of discriminants at selected arguments k (e.g. the prime powers <= K)
+    Input:
+        ds (Sequence[int]): Discriminants
+        ks (np.ndarray): Arguments k >= 0
+        backend (str): "auto" | "native" | "mpmath" (Sage reference)
+    Return:
+        Array of shape (len(ks), len(ds)) with entry [j, b] = (ds[b] | ks[j])
+    """
+    ds_arr  = np.ascontiguousarray(ds, dtype=np.int64)
+    ks_arr  = np.ascontiguousarray(ks, dtype=np.int64)
+    chi_mat = np.empty((len(ks_arr), len(ds_arr)), dtype=np.int8)
+    if resolve_backend(backend) == "native":
+        _native.kronecker_matrix(ds_arr, ks_arr, chi_mat)
+        return chi_mat
+
+    from sage.all import kronecker_symbol
+    for j, k in enumerate(ks_arr):
+        for b, d in enumerate(ds_arr):
+            chi_mat[j, b] = kronecker_symbol(int(d), int(k))
+    return chi_mat
+
+
+def write_kronecker(d: int, K: int, chi_arr: np.ndarray, data_dir = str | Path) -> int:
     """
     Purpose:
         Save the Kronecker symbol array as a text file in the specified directory
@@ -43,7 +84,7 @@ def write_kronecker(d: int, K: int, chi_arr: np.ndarray, data_dir = str | Path)
         chi_arr (np.ndarray): Array containing Kronecker symbol
         data_dir (str): Path to data directory
     Return:
-        None
+        Number of bytes written
     """  
     # Ensure the storing directory exists
     target = Path(data_dir).expanduser() / ("positive_d" if d > 0 else "negative_d") / f"d_{d}"
@@ -51,7 +92,8 @@ def write_kronecker(d: int, K: int, chi_arr: np.ndarray, data_dir = str | Path)
 
     # Save the kronecker values to the kronecker.txt file
     txt_path = target / "kronecker.txt"
-    with open(txt_path, "w") as f:
-        for k in range(1, K + 1):
-            f.write(f"{k} {chi_arr[k]}\n")  
+    text = "".join(f"{k} {chi_arr[k]}\n" for k in range(1, K + 1)).encode()
+    with open(txt_path, "wb") as f:
+        f.write(text)
+    return len(text)
             
\ No newline at end of file
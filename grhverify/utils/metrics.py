@@ -0,0 +1,165 @@
+"""
+metrics.py
+
+Low-overhead per-discriminant timers and counters for the verification hot path
+
+Classes:
+    - Metrics: Wall time per stage and event counters for one discriminant
+    - MetricsReport: Aggregate of many Metrics snapshots (totals, means, share of wall time per stage)
+
+Functions:
+    - current(): The Metrics of this thread, being filled for the discriminant in progress
+    - begin(): Reset and return current() at the start of a discriminant
+    - combine(total, extra): Add one snapshot into another (e.g. a prefetch thread's lcalc work into its d)
+
+Constants:
+    - STAGES   — Timed stages: kronecker, lambda, series (L'/L), lcalc, lhs (zero contributions), write
+    - COUNTERS — lcalc_calls, zeros_requested, zeros_used, bytes_written, dps (mpmath digits), arb_bits
+    - COLUMNS  — Snapshot keys (t_<stage> seconds, then the counters), i.e. the metrics.csv columns after d
+
+Notes
+-----
+- A stage costs two perf_counter() calls and a dict update (well under a microsecond), so metrics are always
+  collected; driver.py only decides whether to write them (--metrics) and prints the aggregate at the end
+- Stages nest exclusively: time spent in an inner stage (e.g. lcalc reads while the LHS loop pulls zeros) is
+  charged to the inner stage only, so the stage times of a discriminant add up to its instrumented wall time
+- One collector per thread: workers fill their own and ship a plain-dict snapshot back with each result; a
+  zero-prefetch thread (scheduler.py) fills a separate one that is combined into its d afterwards. Time
+  spent there overlaps the other stages, so with prefetching the stage times can exceed the wall time
+"""
+
+import threading
+import time
+from typing import Dict, List
+
+STAGES   = ("kronecker", "lambda", "series", "lcalc", "lhs", "write")
+COUNTERS = ("lcalc_calls", "zeros_requested", "zeros_used", "bytes_written", "dps", "arb_bits")
+LEVELS   = ("dps", "arb_bits")          # Precision levels: reported as the maximum, not summed
+COLUMNS  = tuple(f"t_{stage}" for stage in STAGES) + COUNTERS
+
+
+class Metrics:
+    """
+    Purpose:
+        Stage timers (seconds) and counters for one discriminant
+    """
+
+    __slots__ = ("times", "counts", "_inner")
+
+    def __init__(self) -> None:
+        self.times: Dict[str, float] = dict.fromkeys(STAGES, 0.0)
+        self.counts: Dict[str, float] = dict.fromkeys(COUNTERS, 0)
+        self._inner: List[float] = []      # Time of nested stages, one slot per open stage
+
+    def reset(self) -> None:
+        """Zero every timer and counter"""
+        for stage in self.times:
+            self.times[stage] = 0.0
+        for name in self.counts:
+            self.counts[name] = 0
+
+    def stage(self, name: str) -> "_Stage":
+        """Context manager adding the wall time of the enclosed block, minus that of nested stages, to `name`"""
+        return _Stage(self, name)
+
+    def count(self, name: str, n: float = 1) -> None:
+        """Increase counter `name` by n"""
+        self.counts[name] += n
+
+    def set(self, name: str, value: float) -> None:
+        """Overwrite counter `name` (e.g. the precision used)"""
+        self.counts[name] = value
+
+    def snapshot(self) -> Dict[str, float]:
+        """Picklable copy, one entry per COLUMNS name"""
+        row = {f"t_{stage}": seconds for stage, seconds in self.times.items()}
+        row.update(self.counts)
+        return row
+
+
+class _Stage:
+    # Plain class rather than @contextmanager: cheaper, and exceptions (StopIteration included) pass untouched
+    __slots__ = ("metrics", "name", "start")
+
+    def __init__(self, metrics: Metrics, name: str) -> None:
+        self.metrics = metrics
+        self.name    = name
+
+    def __enter__(self) -> None:
+        self.metrics._inner.append(0.0)
+        self.start = time.perf_counter()
+
+    def __exit__(self, *exc) -> None:
+        elapsed = time.perf_counter() - self.start
+        inner   = self.metrics._inner
+        self.metrics.times[self.name] += elapsed - inner.pop()
+        if inner:
+            inner[-1] += elapsed
+
+
+class MetricsReport:
+    """
+    Purpose:
+        Accumulate snapshots over a run and format the aggregate report
+    """
+
+    def __init__(self) -> None:
+        self.n = 0
+        self.totals: Dict[str, float] = dict.fromkeys(COLUMNS, 0.0)
+
+    def add(self, snapshot: Dict[str, float]) -> None:
+        """Fold in one discriminant's snapshot (an empty one, e.g. an extra target row of the same d, is ignored)"""
+        if not snapshot:
+            return
+        self.n += 1
+        for name in COLUMNS:
+            value = snapshot.get(name, 0.0)
+            self.totals[name] = max(self.totals[name], value) if name in LEVELS else self.totals[name] + value
+
+    def lines(self) -> List[str]:
+        """
+        Purpose:
+            Human-readable aggregate: per-stage total / mean / share, then counter totals and means
+        Return:
+            List of report lines
+        """
+        if self.n == 0:
+            return ["No discriminants processed"]
+        timed = sum(self.totals[f"t_{stage}"] for stage in STAGES) or 1.0
+        lines = [f"Metrics over {self.n} discriminants"]
+        for stage in STAGES:
+            total = self.totals[f"t_{stage}"]
+            lines.append(f"  {stage:<10} {total:10.3f} s   {1e3 * total / self.n:9.3f} ms/d   {100 * total / timed:5.1f} %")
+        for name in COUNTERS:
+            total = self.totals[name]
+            if name in LEVELS:
+                lines.append(f"  {name:<16} max   {total:14.0f}")
+            else:
+                lines.append(f"  {name:<16} total {total:14.0f}   mean {total / self.n:10.2f}")
+        return lines
+
+
+_local = threading.local()
+
+
+def current() -> Metrics:
+    """Collector of the discriminant in progress (per thread)"""
+    metrics = getattr(_local, "metrics", None)
+    if metrics is None:
+        metrics = _local.metrics = Metrics()
+    return metrics
+
+
+def begin() -> Metrics:
+    """Start a new discriminant: reset and return the collector"""
+    metrics = current()
+    metrics.reset()
+    return metrics
+
+
+def combine(total: Dict[str, float], extra: Dict[str, float]) -> Dict[str, float]:
+    """Add snapshot `extra` into `total` in place (levels take the maximum) and return it"""
+    for name in COLUMNS:
+        value = extra.get(name, 0.0)
+        total[name] = max(total.get(name, 0.0), value) if name in LEVELS else total.get(name, 0.0) + value
+    return total
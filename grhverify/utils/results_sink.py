@@ -0,0 +1,281 @@
+"""
+results_sink.py
+
+Single writer for the per-discriminant outputs of a sweep: summary rows, metrics rows, error lines and the
+checkpoint journal, buffered and flushed in batches
+
+Classes:
+    - ResultsSink(output_dir, summary_format, flush_rows, flush_seconds, metrics, journal): Buffer results and write
+      them in batches on a row-count or time threshold, and on close
+
+Functions:
+    - completed_from_outputs(output_dir): Discriminants already recorded by any summary backend in output_dir
+    - summary_rows(output_dir): Every (d, eta, N_needed) row of every summary backend in output_dir, in file order
+    - raise_on_signals(signals): Turn SIGTERM (and the like) into SystemExit so `with ResultsSink(...)` flushes on shutdown
+
+Constants:
+    - SUMMARY_FORMATS — "csv" (summary.csv), "csv.gz" (summary.csv.gz), "parquet" (summary_parquet/part-*.parquet)
+
+Notes
+-----
+- Only the parent process writes: worker results arrive through run_sweep and errors travel with them, so no
+  file is opened per d or per failure, and on a network filesystem a batch costs a handful of writes
+- Order within a flush: summary, metrics and errors first; journal records last, so a discriminant is
+  journaled only once its summary row is on disk and --resume never skips an unrecorded d
+- A signal never writes from inside a handler: raise_on_signals converts it into SystemExit, the sweep loop
+  unwinds and close() flushes the pending batch
+- csv.gz appends one gzip member per flush (valid concatenated gzip); parquet writes one small file per flush,
+  renamed into place, so a crash never leaves an unreadable footer-less file (needs pyarrow)
+"""
+
+import csv
+import gzip
+import io
+import os
+import signal
+import time
+import zlib
+from pathlib import Path
+from typing import Dict, Iterable, Iterator, List, Optional, Set, Tuple
+
+from .checkpoint import CheckpointJournal, completed_from_summary
+from .metrics import COLUMNS as METRIC_COLUMNS
+
+SUMMARY_FORMATS = ("csv", "csv.gz", "parquet")
+SUMMARY_HEADER  = ("d", "eta", "N_needed")
+
+FLUSH_ROWS    = 1024        # Rows per batch
+FLUSH_SECONDS = 5.0         # Longest time a finished row waits in memory
+
+
+def _csv_text(rows: Iterable[Tuple]) -> str:
+    buffer = io.StringIO()
+    csv.writer(buffer).writerows(rows)
+    return buffer.getvalue()
+
+
+def _gzip_members(path: Path, block: int = 1 << 20) -> Iterator[str]:
+    # Concatenated gzip members, decoded one at a time: only complete ones count, a member torn by a crash ends the read
+    with open(path, "rb") as f:
+        member, parts, pending = zlib.decompressobj(wbits=31), [], b""
+        while True:
+            data = pending or f.read(block)
+            pending = b""
+            if not data:
+                return
+            try:
+                parts.append(member.decompress(data))
+            except zlib.error:
+                return
+            if member.eof:
+                yield b"".join(parts).decode()
+                member, parts, pending = zlib.decompressobj(wbits=31), [], member.unused_data
+
+
+def _gzip_text(path: Path) -> str:
+    return "".join(_gzip_members(path))
+
+
+def completed_from_outputs(output_dir: str | Path) -> Set[int]:
+    """
+    Purpose:
+        Collect the discriminants with a summary row in output_dir, whichever backend wrote them
+    Input:
+        output_dir (str | Path): Output directory of earlier runs
+    Return:
+        Set of completed discriminants
+    """
+    output_dir = Path(output_dir).expanduser()
+    done = completed_from_summary(output_dir / "summary.csv")
+
+    gz_path = output_dir / "summary.csv.gz"
+    if gz_path.is_file():
+        for row in csv.reader(_gzip_text(gz_path).splitlines()):
+            try:
+                done.add(int(row[0]))
+            except (ValueError, IndexError):
+                continue        # header or malformed row
+
+    parts = sorted((output_dir / "summary_parquet").glob("part-*.parquet"))
+    if parts:
+        import pyarrow.parquet as pq
+        for part in parts:
+            done.update(int(d) for d in pq.read_table(part, columns=["d"]).column("d").to_pylist())
+    return done
+
+
+def summary_rows(output_dir: str | Path) -> Iterator[Tuple[int, float, int]]:
+    """
+    Purpose:
+        Read back the summary rows of output_dir from every backend (csv, csv.gz, parquet parts), in the order
+        they were written; rows without an eta column (older summaries: d, N_needed) get eta = nan
+    Input:
+        output_dir (str | Path): Output directory of a run
+    Return:
+        Iterator over (d, eta, N_needed)
+    """
+    output_dir = Path(output_dir).expanduser()
+
+    def complete_lines(f) -> Iterator[str]:
+        for line in f:
+            if line.endswith("\n"):     # a partial last row (crash mid-write) is dropped
+                yield line
+
+    def parse(lines: Iterable[str]) -> Iterator[Tuple[int, float, int]]:
+        # Columns by header name, so merged summaries (d, eta, K, eps, N_needed, success) read back as well
+        columns = {"d": 0, "eta": 1, "N_needed": 2}
+        for row in csv.reader(lines):
+            if row and row[0] == "d":
+                columns = {name: i for i, name in enumerate(row)}
+                continue
+            try:
+                eta = float(row[columns["eta"]]) if "eta" in columns else float("nan")
+                yield int(row[columns["d"]]), eta, int(row[columns["N_needed"]])
+            except (ValueError, IndexError, KeyError):
+                continue        # malformed row
+
+    csv_path = output_dir / "summary.csv"
+    if csv_path.is_file():
+        with open(csv_path, newline="") as f:
+            yield from parse(complete_lines(f))
+    if (output_dir / "summary.csv.gz").is_file():
+        # The header is in the first member only: parse the members as one line stream
+        yield from parse(line for text in _gzip_members(output_dir / "summary.csv.gz") for line in text.splitlines())
+
+    parts = sorted((output_dir / "summary_parquet").glob("part-*.parquet"))
+    if parts:
+        import pyarrow.parquet as pq
+        for part in parts:
+            table = pq.read_table(part).to_pydict()
+            yield from zip(table["d"], table["eta"], table["N_needed"])
+
+
+def raise_on_signals(signals: Tuple[int, ...] = (signal.SIGTERM,)) -> None:
+    """
+    Purpose:
+        Make the given signals raise SystemExit in the main thread (SIGINT already raises KeyboardInterrupt)
+    Input:
+        signals (Tuple[int, ...]): Signal numbers
+    """
+    def _exit(signum, frame):
+        raise SystemExit(128 + signum)
+    for signum in signals:
+        signal.signal(signum, _exit)
+
+
+class ResultsSink:
+    """
+    Purpose:
+        Buffered single writer of summary rows, metrics rows, error lines and journal records
+    Input:
+        output_dir (str | Path): Output directory
+        summary_format (str): One of SUMMARY_FORMATS
+        flush_rows (int): Flush once this many rows are pending
+        flush_seconds (float): Flush once the oldest pending row is this old
+        metrics (bool): Also write metrics.csv (stage timers and counters per d)
+        journal (Optional[CheckpointJournal]): Journal receiving the d of every flushed row
+    """
+
+    def __init__(self, output_dir: str | Path, summary_format: str = "csv", flush_rows: int = FLUSH_ROWS, flush_seconds: float = FLUSH_SECONDS, metrics: bool = False, journal: Optional[CheckpointJournal] = None) -> None:
+        if summary_format not in SUMMARY_FORMATS:
+            raise ValueError(f"summary_format must be one of {SUMMARY_FORMATS}, got {summary_format!r}")
+        if summary_format == "parquet":
+            import pyarrow          # noqa: F401  (fail at start-up, not at the first flush)
+
+        self.output_dir     = Path(output_dir).expanduser()
+        self.output_dir.mkdir(parents=True, exist_ok=True)
+        self.summary_format = summary_format
+        self.flush_rows     = max(1, flush_rows)
+        self.flush_seconds  = flush_seconds
+        self.metrics        = metrics
+        self.journal        = journal
+        self.flushes        = 0
+
+        self._rows: List[Tuple[int, float, int]] = []
+        self._metric_rows: List[Tuple] = []
+        self._errors: List[str] = []
+        self._oldest: Optional[float] = None
+
+    # --------------------------- buffering ---------------------------
+
+    def add(self, d: int, eta: float, N_used: int, metrics: Optional[Dict[str, float]] = None, error: Optional[str] = None) -> None:
+        """
+        Purpose:
+            Queue the outputs of one discriminant, flushing if a threshold is reached
+        Input:
+            d (int): Discriminant
+            eta (float): Height used
+            N_used (int): Zeros needed
+            metrics (Optional[Dict]): Metrics snapshot of d (written if the sink was opened with metrics=True and it is non-empty)
+            error (Optional[str]): Error line(s) of d for errors.log
+        """
+        now = time.monotonic()
+        if self._oldest is None:
+            self._oldest = now
+        self._rows.append((d, eta, N_used))
+        if self.metrics and metrics:
+            self._metric_rows.append((d, *(metrics[name] for name in METRIC_COLUMNS)))
+        if error:
+            self._errors.append(error if error.endswith("\n") else error + "\n")
+
+        if len(self._rows) >= self.flush_rows or now - self._oldest >= self.flush_seconds:
+            self.flush()
+
+    # --------------------------- writing ---------------------------
+
+    def _append_text(self, name: str, header: Tuple[str, ...], rows: List[Tuple]) -> None:
+        # One write per batch; the header only when the file is new
+        path = self.output_dir / name
+        text = _csv_text(([header] if not path.exists() else []) + rows)
+        with open(path, "a", newline="") as f:
+            f.write(text)
+
+    def _write_summary(self) -> None:
+        if self.summary_format == "csv":
+            self._append_text("summary.csv", SUMMARY_HEADER, self._rows)
+
+        elif self.summary_format == "csv.gz":
+            path = self.output_dir / "summary.csv.gz"
+            text = _csv_text(([SUMMARY_HEADER] if not path.exists() else []) + self._rows)
+            with open(path, "ab") as f:
+                f.write(gzip.compress(text.encode()))
+
+        else:
+            import pyarrow as pa
+            import pyarrow.parquet as pq
+            d, eta, N = zip(*self._rows)
+            table = pa.table({"d": pa.array(d, pa.int64()), "eta": pa.array(eta, pa.float64()), "N_needed": pa.array(N, pa.int64())})
+            parts = self.output_dir / "summary_parquet"
+            parts.mkdir(exist_ok=True)
+            name = f"part-{time.time_ns()}-{os.getpid()}.parquet"
+            pq.write_table(table, parts / f".{name}.tmp")
+            os.replace(parts / f".{name}.tmp", parts / name)
+
+    def flush(self) -> None:
+        """Write every pending row, then journal the flushed discriminants"""
+        if self._rows:
+            self._write_summary()
+        if self._metric_rows:
+            self._append_text("metrics.csv", ("d", *METRIC_COLUMNS), self._metric_rows)
+        if self._errors:
+            with open(self.output_dir / "errors.log", "a") as log:
+                log.write("".join(self._errors))
+        if self.journal is not None and self._rows:
+            self.journal.record_many(d for d, _, _ in self._rows)
+
+        if self._rows:
+            self.flushes += 1
+        self._rows.clear()
+        self._metric_rows.clear()
+        self._errors.clear()
+        self._oldest = None
+
+    def close(self) -> None:
+        """Flush what is pending (the journal stays owned by the caller)"""
+        self.flush()
+
+    def __enter__(self) -> "ResultsSink":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
@@ -5,37 +5,122 @@ Compute and persist the von Mangoldt function values Λ(n) for n up to a given b
 
 Functions:
     - compute_lambda(K): Build an array Λ[0..K] of von Mangoldt values
+    - compute_lambda_sparse(K): The non-zero entries of Λ[1..K] as (prime powers, log p) arrays
+    - lambda_table(K, data_dir): Process-wide, K-keyed cached Λ[0..K] (optionally backed by von_mangoldt.bin)
     - write_lambda(K, lambda_arr, data_dir): Save the Λ-array to a text file under a specified directory
+    - write_lambda_bin(K, data_dir): Save the dense Λ table to data_dir/von_mangoldt.bin
+    - load_lambda_bin(path): Memory-map a von_mangoldt.bin file as a read-only Λ[0..K] view
 
+Notes
+-----
+- von_mangoldt.bin layout (little-endian): 32-byte header [magic b"GRHLAM02", K (uint64), count (uint64) of prime
+  powers, 8 bytes reserved], then the dense float64 column Λ(0..K)
+- The file is written once (atomically) and the mapping itself is what lambda_table returns, so every worker
+  process reads the same page-cache pages instead of scattering its own dense copy; the kernels all index Λ
+  densely, which is why the file holds the dense column rather than (k, log p) pairs (8 bytes per k: 8 MB at K = 10^6)
+- A file of the older sparse layout (b"GRHLAM01") or of a smaller K is rewritten on first use
 """
 
+import os
 import math
 import numpy as np
 from pathlib import Path
-from sage.all import prime_range    # Generate primes in [a, b)
+from typing import Dict, Optional, Tuple
 
-def compute_lambda(K: int) -> np.ndarray:
+LAMBDA_BIN_MAGIC  = b"GRHLAM02"
+LAMBDA_BIN_HEADER = 32
+
+# Process-wide cache: Λ depends only on K
+_LAMBDA_CACHE: Dict[int, np.ndarray] = {}
+
+
+def compute_lambda_sparse(K: int) -> Tuple[np.ndarray, np.ndarray]:
     """
     Purpose:
-        Compute the von Mangoldt function values Λ(k) for 1 <= k <= K
-        Λ(n) = log(p) exactly when n is a prime power p^k, and zero otherwise
-    Input:  
+        Compute the non-zero von Mangoldt values: Λ(p^e) = log(p) for prime powers p^e <= K
+    Input:
         K (int): Upper bound for k in Λ(k)
-    Return: 
-        Array of shape (K +1,) where lambda_arr[k] = Λ(k) and lambda_arr[0] is unused (set to 0)
+    Return:
+        (k_idx, log_p): int64 prime powers in increasing order and the matching float64 values
     """
     # Input validation
     if not (isinstance(K, int) and K >= 1):
         raise ValueError(f"The upper bound K must be a positive integer")
-    
-    # Compute the von Mangoldt lambda value for k = 1..K
-    lambda_arr = np.zeros(K + 1, dtype=float)
-    for p in prime_range(2, K + 1):
+
+    # Sieve of Eratosthenes over [0, K]
+    is_prime = np.ones(K + 1, dtype=bool)
+    is_prime[:2] = False
+    for p in range(2, math.isqrt(K) + 1):
+        if is_prime[p]:
+            is_prime[p * p::p] = False
+
+    # Expand each prime to its powers p, p^2, ... <= K
+    idx, vals = [], []
+    for p in np.flatnonzero(is_prime):
+        p = int(p)
         log_p = math.log(p)
         q = p
         while q <= K:
-            lambda_arr[q] = log_p
+            idx.append(q)
+            vals.append(log_p)
             q *= p
+
+    k_idx = np.asarray(idx, dtype=np.int64)
+    log_p = np.asarray(vals, dtype=np.float64)
+    order = np.argsort(k_idx, kind="stable")
+    return k_idx[order], log_p[order]
+
+
+def compute_lambda(K: int) -> np.ndarray:
+    """
+    Purpose:
+        Compute the von Mangoldt function values Λ(k) for 1 <= k <= K
+        Λ(n) = log(p) exactly when n is a prime power p^k, and zero otherwise
+    Input:
+        K (int): Upper bound for k in Λ(k)
+    Return:
+        Array of shape (K +1,) where lambda_arr[k] = Λ(k) and lambda_arr[0] is unused (set to 0)
+    """
+    # Scatter the sparse table into a dense array
+    k_idx, log_p = compute_lambda_sparse(K)
+    lambda_arr = np.zeros(K + 1, dtype=float)
+    lambda_arr[k_idx] = log_p
+    return lambda_arr
+
+
+def lambda_table(K: int, data_dir: Optional[str | Path] = None) -> np.ndarray:
+    """
+    Purpose:
+        Return Λ[0..K], computed at most once per process for each K
+        With data_dir, the table is the read-only mapping of data_dir/von_mangoldt.bin (written once if missing)
+    Input:
+        K (int): Upper bound for k in Λ(k)
+        data_dir (Optional[str | Path]): Directory holding von_mangoldt.bin
+    Return:
+        Read-only array of shape (K + 1,), shared by every caller (and every process mapping the same file)
+    """
+    cached = _LAMBDA_CACHE.get(K)
+    if cached is not None:
+        return cached
+
+    if data_dir is None:
+        lambda_arr = compute_lambda(K)
+        lambda_arr.setflags(write=False)
+    else:
+        bin_path = Path(data_dir).expanduser() / "von_mangoldt.bin"
+        lambda_arr = None
+        if bin_path.is_file():
+            try:
+                file_K, mapped = load_lambda_bin(bin_path)
+                if file_K >= K:
+                    lambda_arr = mapped[:K + 1]
+            except ValueError:
+                pass        # older sparse layout or a damaged file: rewritten below
+        if lambda_arr is None:
+            write_lambda_bin(K, data_dir)
+            _, lambda_arr = load_lambda_bin(bin_path)
+
+    _LAMBDA_CACHE[K] = lambda_arr
     return lambda_arr
 
 
@@ -43,7 +128,7 @@ def write_lambda(K: int, lambda_arr: np.ndarray, data_dir: str | Path) -> None:
     """
     Purpose:
         Save the von Mangoldt array as a text file in the specified directory
-    Input:  
+    Input:
         K (int): Upper bound for k in Λ(k)
         lambda_arr (np.ndarray): Array containing von Mangoldt values
         data_dir (str | Path): Path to data directory
@@ -59,3 +144,51 @@ def write_lambda(K: int, lambda_arr: np.ndarray, data_dir: str | Path) -> None:
     with open(txt_path, "w") as f:
         for k in range(1, K + 1):
             f.write(f"{k} {lambda_arr[k]}\n")
+
+
+def write_lambda_bin(K: int, data_dir: str | Path) -> Path:
+    """
+    Purpose:
+        Save the dense von Mangoldt table Λ(0..K) to data_dir/von_mangoldt.bin
+        Written to a temporary file and renamed, so concurrent readers never see a partial file
+    Input:
+        K (int): Upper bound for k in Λ(k)
+        data_dir (str | Path): Path to data directory
+    Return:
+        Path of the written file
+    """
+    base = Path(data_dir).expanduser()
+    base.mkdir(parents=True, exist_ok=True)
+    bin_path = base / "von_mangoldt.bin"
+
+    lambda_arr = compute_lambda(K)
+    header = np.zeros(LAMBDA_BIN_HEADER, dtype=np.uint8)
+    header[:8] = np.frombuffer(LAMBDA_BIN_MAGIC, dtype=np.uint8)
+    header[8:24] = np.array([K, np.count_nonzero(lambda_arr)], dtype="<u8").view(np.uint8)
+
+    tmp_path = bin_path.with_name(f"{bin_path.name}.{os.getpid()}.tmp")
+    with open(tmp_path, "wb") as f:
+        f.write(header.tobytes())
+        f.write(lambda_arr.astype("<f8").tobytes())
+    os.replace(tmp_path, bin_path)
+    return bin_path
+
+
+def load_lambda_bin(path: str | Path) -> Tuple[int, np.ndarray]:
+    """
+    Purpose:
+        Memory-map a von_mangoldt.bin file; the pages are shared read-only between processes
+    Input:
+        path (str | Path): Path to von_mangoldt.bin
+    Return:
+        (K, lambda_arr) with lambda_arr = Λ[0..K] a read-only view into the mapping
+    """
+    raw = np.memmap(Path(path).expanduser(), dtype=np.uint8, mode="r")
+    if raw.size < LAMBDA_BIN_HEADER or raw[:8].tobytes() != LAMBDA_BIN_MAGIC:
+        raise ValueError(f"{path} is not a version-2 von_mangoldt.bin file")
+
+    K = int(raw[8:16].view("<u8")[0])
+    lambda_arr = raw[LAMBDA_BIN_HEADER:LAMBDA_BIN_HEADER + 8 * (K + 1)].view("<f8")
+    if len(lambda_arr) != K + 1:
+        raise ValueError(f"{path} is truncated")
+    return K, lambda_arr
@@ -0,0 +1,152 @@
+"""
+zero_cache.py
+
+Persistent cache of zero ordinates of L(s, χ_d), consulted before lcalc is called
+
+Classes:
+    - ZeroCache(data_dir, precision): Per-d zero lists keyed by (d, precision), answering prefix queries by
+      count or by height and growing as longer lists are computed
+
+Notes
+-----
+- Zeros are computed in increasing order, so any cached list answers every query for a shorter prefix:
+  "the first N zeros" needs N cached ordinates, "every zero up to height T" needs a cached ordinate > T
+- Entries live in data_dir/zero_cache/<precision>/{positive_d|negative_d}/d_{d}.f64 as raw little-endian
+  float64, memory-mapped on read and replaced atomically when a longer list is stored
+- On a miss the cache falls back to what earlier runs left in data_dir: the block store (data_store.py) and
+  the legacy zeros.txt files of write_zeros
+- `precision` separates lists computed at different working precisions (e.g. a multiprecision lcalc build);
+  lists of different precisions are never mixed
+"""
+
+import os
+import threading
+import numpy as np
+from pathlib import Path
+from typing import Dict, Optional
+
+from .data_store import DataStore
+
+DEFAULT_PRECISION = "double"        # lcalc's default double-precision zero finder
+MEMORY_ENTRIES    = 64              # Recently used lists kept in memory (a sweep touches each d once or twice)
+
+
+class ZeroCache:
+    """
+    Purpose:
+        Serve prefixes of previously computed zero lists and record longer ones
+    Input:
+        data_dir (str | Path): Data directory of the run
+        precision (str): Precision tag of the zero finder producing the lists
+    """
+
+    def __init__(self, data_dir: str | Path, precision: str = DEFAULT_PRECISION) -> None:
+        self.data_dir  = Path(data_dir).expanduser()
+        self.precision = precision
+        self.root      = self.data_dir / "zero_cache" / precision
+        self.hits      = 0
+        self.misses    = 0
+
+        self._memory: Dict[int, np.ndarray] = {}
+        self._lock = threading.Lock()      # The memory layer is shared with a zero-prefetch thread
+        self._store: Optional[DataStore] = None
+
+    def path(self, d: int) -> Path:
+        """Cache file of d"""
+        return self.root / ("positive_d" if d > 0 else "negative_d") / f"d_{d}.f64"
+
+    # --------------------------- lookup ---------------------------
+
+    def _remember(self, d: int, zeros: np.ndarray) -> None:
+        # Bounded in-memory layer: drop the oldest entry once full
+        with self._lock:
+            self._memory.pop(d, None)
+            if len(self._memory) >= MEMORY_ENTRIES:
+                self._memory.pop(next(iter(self._memory)))
+            self._memory[d] = zeros
+
+    def _legacy(self, d: int) -> np.ndarray:
+        # Zeros left by earlier runs in the block store or in zeros.txt (double precision only)
+        if self.precision != DEFAULT_PRECISION:
+            return np.zeros(0)
+        if self._store is None:
+            self._store = DataStore(self.data_dir)
+        best = np.asarray(self._store.zeros(d), dtype=np.float64)
+
+        txt_path = self.data_dir / ("positive_d" if d > 0 else "negative_d") / f"d_{d}" / "zeros.txt"
+        if txt_path.is_file():
+            with open(txt_path) as f:
+                text_zeros = np.array([float(line) for line in f if line.strip()], dtype=np.float64)
+            if len(text_zeros) > len(best):
+                best = text_zeros
+        return best
+
+    def known(self, d: int) -> np.ndarray:
+        """
+        Purpose:
+            Every cached zero of d (read-only; empty if none)
+        Input:
+            d (int): Discriminant
+        Return:
+            np.ndarray of increasing ordinates
+        """
+        zeros = self._memory.get(d)
+        if zeros is not None:
+            return zeros
+
+        path = self.path(d)
+        if path.is_file() and path.stat().st_size >= 8:
+            zeros = np.memmap(path, dtype="<f8", mode="r")
+        else:
+            zeros = self._legacy(d)
+        self._remember(d, zeros)
+        return zeros
+
+    def get(self, d: int, count: Optional[int] = None, height: Optional[float] = None) -> Optional[np.ndarray]:
+        """
+        Purpose:
+            Answer a prefix query from the cache
+        Input:
+            d (int): Discriminant
+            count (Optional[int]): Number of leading zeros wanted
+            height (Optional[float]): Return every zero with ordinate <= height instead
+        Return:
+            np.ndarray prefix, or None if the cache cannot answer the query completely
+        """
+        if (count is None) == (height is None):
+            raise ValueError("Give exactly one of count or height")
+
+        zeros = self.known(d)
+        if count is not None:
+            found = zeros[:count] if len(zeros) >= count else None
+        else:
+            # Completeness up to T is only known once a zero above T has been seen
+            found = zeros[:int(np.searchsorted(zeros, height, side="right"))] if len(zeros) and zeros[-1] > height else None
+
+        if found is None:
+            self.misses += 1
+        else:
+            self.hits += 1
+        return found
+
+    # --------------------------- update ---------------------------
+
+    def put(self, d: int, zeros) -> None:
+        """
+        Purpose:
+            Record the leading zeros of d if they extend what is cached
+        Input:
+            d (int): Discriminant
+            zeros: Leading zero ordinates, increasing
+        """
+        zeros = np.ascontiguousarray(zeros, dtype="<f8")
+        if len(zeros) <= len(self.known(d)):
+            return
+
+        path = self.path(d)
+        path.parent.mkdir(parents=True, exist_ok=True)
+        tmp_path = path.with_name(f"{path.name}.{os.getpid()}.tmp")
+        with open(tmp_path, "wb") as f:
+            f.write(zeros.tobytes())
+        os.replace(tmp_path, path)
+        self._remember(d, zeros)
@@ -0,0 +1,317 @@
+"""
+zero_stream.py
+
+Lazy, incremental supply of zero ordinates of L(s, χ_d) from a running lcalc process
+
+Classes:
+    - ZeroStream(d, lcalc_path, initial, growth, prefix, engine, cache): Iterable over the positive zero ordinates of L(s, χ_d)
+      that reads lcalc's output line by line as it is produced and stops lcalc once the consumer is done
+    - ZeroBatchFetcher(lcalc_path, N, width, d_max, cache): Prefetch the first N zeros of a whole d-interval per lcalc run and
+      hand them out per discriminant (e.g. as ZeroStream prefixes in range mode)
+
+Notes
+-----
+- lcalc has no interactive session mode, so a stream asks for `initial` zeros and, if the consumer needs
+  more, relaunches with a geometrically larger count and skips the prefix it already holds. A verification
+  needing N zeros therefore costs O(log N) launches instead of N / chunk
+- Zeros already known (e.g. the first zero used to choose eta in driver.py) can be passed as `prefix`
+- With the lcalc library engine there is no process: each growth step is one in-process zero-finder call
+- With a ZeroCache, a stream starts from the cached zeros of d and records what it computed on close, so a
+  rerun with another eta / eps only pays for zeros beyond the longest list computed before
+- Zeros live in one float64 buffer grown by doubling; take() and known return read-only NumPy views of it,
+  which the native kernels, the block store and the cache read without copying or boxing. A cached list
+  is used as the initial buffer in place (memory-mapped) until the first zero is appended
+"""
+
+import subprocess
+from pathlib import Path
+from typing import Dict, Iterator, List, Optional, Sequence
+
+import numpy as np
+
+from .generate_zeros import lcalc_command, parse_zero_line, resolve_engine, compute_zeros_array, compute_zeros_range
+from .zero_cache import ZeroCache
+from . import metrics
+
+
+class ZeroStream:
+    """
+    Purpose:
+        Provide the zero ordinates of L(s, χ_d) in increasing order, computed on demand
+    Input:
+        d (int): Fundamental discriminant of the Dirichlet character χ_d
+        lcalc_path (str | Path): Path to the lcalc executable
+        initial (int): Number of zeros requested from the first lcalc launch
+        growth (int): Factor by which the request grows on each relaunch
+        prefix (Optional[Sequence[float]]): Leading zeros already known
+        engine (str): "auto" | "library" | "subprocess" (see generate_zeros.resolve_engine)
+        cache (Optional[ZeroCache]): Zero cache seeding the stream and updated on close
+    """
+
+    def __init__(self, d: int, lcalc_path: str | Path, initial: int = 16, growth: int = 2, prefix: Optional[Sequence[float]] = None, engine: str = "auto", cache: Optional[ZeroCache] = None) -> None:
+        # Input validation
+        if not isinstance(d, int):
+            raise TypeError("Discriminant d must be an integer")
+        if not (isinstance(initial, int) and initial >= 1):
+            raise ValueError("initial must be a positive integer")
+        if not (isinstance(growth, int) and growth >= 2):
+            raise ValueError("growth must be an integer >= 2")
+
+        self.d          = d
+        self.lcalc_path = lcalc_path
+        self.initial    = initial
+        self.growth     = growth
+        self.engine     = resolve_engine(engine, d)
+        self.cache      = cache
+
+        # Start from the longer of the given prefix and the cached list, without copying either
+        self._buf = np.asarray(prefix if prefix is not None else (), dtype=np.float64)
+        if cache is not None:
+            cached = cache.known(d)
+            if len(cached) > len(self._buf):
+                self._buf = cached
+        self._n      = len(self._buf)      # Zeros held; self._buf[self._n:] is spare capacity
+        self._owned  = False               # Whether self._buf may be written (seeds are never modified)
+        self._cached = self._n if cache is not None else 0
+        self._proc: Optional[subprocess.Popen] = None
+        self._requested = 0         # Zeros requested from the current (or last) launch
+        self._produced  = 0         # Zeros read from the current launch
+        self._exhausted = False     # lcalc returned fewer zeros than requested
+        self.launches   = 0         # Number of lcalc processes started
+
+    # --------------------------- buffer ---------------------------
+
+    def _reserve(self, n: int) -> None:
+        # Capacity for n zeros; a seed buffer or a full one is replaced by a doubled private copy
+        if self._owned and len(self._buf) >= n:
+            return
+        buf = np.empty(max(n, 2 * len(self._buf), self.initial), dtype=np.float64)
+        buf[:self._n] = self._buf[:self._n]
+        self._buf, self._owned = buf, True
+
+    def _append(self, zeros: np.ndarray) -> None:
+        # Bulk append (one copy, no per-element boxing)
+        self._reserve(self._n + len(zeros))
+        self._buf[self._n:self._n + len(zeros)] = zeros
+        self._n += len(zeros)
+
+    def _view(self, n: int) -> np.ndarray:
+        # Read-only view of the first n zeros: later appends never touch it, reallocation leaves it valid
+        view = self._buf[:min(n, self._n)]
+        view.flags.writeable = False
+        return view
+
+    # --------------------------- process control ---------------------------
+
+    def _launch(self, count: int) -> None:
+        # Start a fresh lcalc run for the first `count` zeros
+        self._close_process()
+        self._proc = subprocess.Popen(
+            lcalc_command(self.d, count, self.lcalc_path),
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+            bufsize=1,
+        )
+        self._requested = count
+        self._produced  = 0
+        self.launches  += 1
+        metrics.current().count("lcalc_calls")
+        metrics.current().count("zeros_requested", count)
+
+    def _close_process(self) -> None:
+        # Stop lcalc if it is still computing zeros nobody will read
+        if self._proc is None:
+            return
+        if self._proc.poll() is None:
+            self._proc.kill()
+        self._proc.communicate()
+        self._proc = None
+
+    def _read_next(self) -> Optional[float]:
+        # Next ordinate from the running process, or None at end of output
+        for line in self._proc.stdout:
+            gamma = parse_zero_line(line)
+            if gamma is not None:
+                return gamma
+
+        # End of output: surface lcalc failures like compute_zeros does
+        _, stderr = self._proc.communicate()
+        status = self._proc.returncode
+        self._proc = None
+        if status != 0:
+            raise RuntimeError(f"lcalc failed with status {status}\nstderr: {stderr}")
+        return None
+
+    def _fill_library(self, n: int) -> None:
+        # In-process lcalc: recompute with a geometrically larger count (no stream to resume)
+        while self._n < n and not self._exhausted:
+            count = max(n, self.initial if self._requested == 0 else self._requested * self.growth)
+            metrics.current().count("lcalc_calls")
+            metrics.current().count("zeros_requested", count)
+            zeros = compute_zeros_array(self.d, count, engine="library", partial=True)
+            self._requested = count
+            self.launches  += 1
+            self._append(zeros[self._n:])
+
+            # Fewer zeros than requested: keep those lcalc did find, there are no more to get
+            if len(zeros) < count:
+                self._exhausted = True
+
+    def _fill(self, n: int) -> None:
+        # Make at least n zeros available (fewer only if lcalc runs out); lcalc time is charged to its stage
+        if self._n >= n or self._exhausted:
+            return
+        with metrics.current().stage("lcalc"):
+            self._fill_lcalc(n)
+
+    def _fill_lcalc(self, n: int) -> None:
+        if self.engine == "library":
+            self._fill_library(n)
+            return
+        while self._n < n and not self._exhausted:
+            # (Re)launch when nothing is running or the current request is used up
+            if self._proc is None:
+                if self._requested == 0:
+                    count = max(n, self.initial)
+                else:
+                    count = max(n, self._requested * self.growth)
+                self._launch(count)
+
+            gamma = self._read_next()
+            if gamma is None:
+                # Process finished: fewer zeros than requested means there are no more to get
+                if self._produced < self._requested:
+                    self._exhausted = True
+                continue
+
+            # The first self._n zeros of a relaunch replay what we already hold
+            self._produced += 1
+            if self._produced > self._n:
+                self._reserve(self._n + 1)
+                self._buf[self._n] = gamma
+                self._n += 1
+
+            # Request satisfied: reap the process so the next fill relaunches
+            if self._produced >= self._requested:
+                self._close_process()
+
+    # --------------------------- public API ---------------------------
+
+    def take(self, n: int) -> np.ndarray:
+        """
+        Purpose:
+            Return the first n zeros, computing only the missing ones
+        Input:
+            n (int): Number of zeros
+        Return:
+            Read-only float64 view of length n, or shorter if lcalc has no more zeros
+        """
+        self._fill(n)
+        return self._view(n)
+
+    def __getitem__(self, index: int) -> float:
+        self._fill(index + 1)
+        if index >= self._n:
+            raise IndexError(f"L(s, χ_{self.d}) has only {self._n} zeros available")
+        return float(self._buf[index])
+
+    def __iter__(self) -> Iterator[float]:
+        index = 0
+        while True:
+            self._fill(index + 1)
+            if index >= self._n:
+                return
+            yield float(self._buf[index])
+            index += 1
+
+    @property
+    def known(self) -> np.ndarray:
+        """Zeros computed so far, as a read-only float64 view (no lcalc work)"""
+        return self._view(self._n)
+
+    def close(self) -> None:
+        """Terminate any running lcalc process and record newly computed zeros in the cache"""
+        self._close_process()
+        if self.cache is not None and self._n > self._cached:
+            with metrics.current().stage("write"):
+                self.cache.put(self.d, self.known)
+            metrics.current().count("bytes_written", 8 * self._n)
+            self._cached = self._n
+
+    def __enter__(self) -> "ZeroStream":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+    def __del__(self) -> None:
+        try:
+            self._close_process()
+        except Exception:
+            pass
+
+
+class ZeroBatchFetcher:
+    """
+    Purpose:
+        Serve the first N zeros of each discriminant from batched lcalc runs over d-intervals of the given width
+        Requests are expected in increasing d (as in --d-min/--d-max sweeps); each interval is fetched once
+    Input:
+        lcalc_path (str | Path): Path to the lcalc executable
+        N (int): Zeros fetched per discriminant
+        width (int): Width of the d-interval covered by one lcalc invocation
+        d_max (Optional[int]): Upper end of the sweep, so the last interval is not over-fetched
+        cache (Optional[ZeroCache]): Zero cache; discriminants it already covers do not trigger a fetch
+    """
+
+    def __init__(self, lcalc_path: str | Path, N: int, width: int = 1000, d_max: Optional[int] = None, cache: Optional[ZeroCache] = None) -> None:
+        if not (isinstance(N, int) and N >= 1):
+            raise ValueError("N must be a positive integer")
+        if not (isinstance(width, int) and width >= 1):
+            raise ValueError("width must be a positive integer")
+
+        self.lcalc_path = lcalc_path
+        self.N          = N
+        self.width      = width
+        self.d_max      = d_max
+        self.cache      = cache
+        self.launches   = 0
+
+        self._lo = 0                # Current interval [lo, hi]
+        self._hi = -1
+        self._queue: Dict[int, List[float]] = {}
+
+    def zeros(self, d: int) -> np.ndarray:
+        """
+        Purpose:
+            First N zeros of L(s, χ_d), fetching the interval starting at d if it is not loaded
+        Input:
+            d (int): Discriminant
+        Return:
+            float64 array (empty if lcalc reported nothing for d, e.g. d not fundamental)
+        """
+        # Cached discriminants are served without an lcalc run (a view of the cached list)
+        if self.cache is not None and not (self._lo <= d <= self._hi):
+            cached = self.cache.get(d, count=self.N)
+            if cached is not None:
+                return cached
+
+        if not (self._lo <= d <= self._hi):
+            hi = d + self.width - 1
+            if self.d_max is not None:
+                hi = max(d, min(hi, self.d_max))
+            with metrics.current().stage("lcalc"):
+                self._queue = compute_zeros_range(d, hi, self.N, self.lcalc_path)
+            self._lo, self._hi = d, hi
+            self.launches += 1
+            metrics.current().count("lcalc_calls")
+            metrics.current().count("zeros_requested", self.N * (hi - d + 1))
+
+        # Each discriminant is consumed once: drop it from the queue
+        return np.asarray(self._queue.pop(d, ()), dtype=np.float64)
+
+    def stream(self, d: int, **kwargs) -> ZeroStream:
+        """Return a ZeroStream for d seeded with the prefetched zeros"""
+        kwargs.setdefault("cache", self.cache)
+        return ZeroStream(d, self.lcalc_path, prefix=self.zeros(d), **kwargs)
@@ -0,0 +1,41 @@
+"""
+setup.py
+
+Build configuration for the optional C++ extension grhverify.native._native
+Package metadata lives in pyproject.toml; if no C++ compiler is available the
+extension is skipped and grhverify falls back to the mpmath reference path
+
+Environment:
+    GRH_LCALC_PREFIX  Install prefix of lcalc (headers in include/lcalc, libLfunction in lib);
+                      when set, zeros are computed in-process through the lcalc library
+"""
+
+import os
+from glob import glob
+
+from setuptools import setup, Extension
+
+# Optional in-process lcalc binding
+lcalc_prefix = os.environ.get("GRH_LCALC_PREFIX")
+lcalc_kwargs = {}
+if lcalc_prefix:
+    lcalc_kwargs = dict(
+        define_macros=[("GRH_WITH_LCALC", "1")],
+        libraries=["Lfunction"],
+        library_dirs=[os.path.join(lcalc_prefix, "lib")],
+        runtime_library_dirs=[os.path.join(lcalc_prefix, "lib")],
+    )
+
+native = Extension(
+    "grhverify.native._native",
+    sources=["grhverify/native/module.cpp"],
+    include_dirs=["grhverify/native"] + ([os.path.join(lcalc_prefix, "include")] if lcalc_prefix else []),
+    depends=glob("grhverify/native/*.hpp"),
+    language="c++",
+    # No -ffast-math or FMA contraction: the double-double kernels rely on strict IEEE semantics
+    extra_compile_args=["-std=c++17", "-O3", "-fno-fast-math", "-ffp-contract=off"],
+    optional=True,
+    **lcalc_kwargs,
+)
+
+setup(ext_modules=[native])
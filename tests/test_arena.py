@@ -0,0 +1,40 @@
+import pytest
+import numpy as np
+
+from grhverify.native import AVAILABLE
+from grhverify.utils.arena import ScratchArena
+from grhverify.utils.kronecker_symbol import compute_kronecker
+
+# ======================= TEST =======================
+
+def test_views_reuse_one_buffer():
+    arena = ScratchArena(100, 16)
+    size = arena.nbytes
+    for K in (50, 100, 20):
+        arena.reset()
+        assert np.shares_memory(arena.chi_table(K), arena.chi) and len(arena.chi_table(K)) == K + 1
+        assert np.shares_memory(arena.prefix_table(16), arena.prefix)
+    assert arena.nbytes == size and arena.resets == 3
+
+
+def test_buffers_grow_only_when_exceeded():
+    arena = ScratchArena(10, 4)
+    assert len(arena.prefix_table(9)) == 9 and len(arena.prefix) >= 9
+    assert len(arena.chi_table(30)) == 31
+
+
+def test_process_arena_grows_with_K(monkeypatch):
+    from grhverify import scheduler
+    monkeypatch.setattr(scheduler, "_process_arena", None)
+    arena = scheduler.process_arena(10)
+    assert scheduler.process_arena(1000) is arena and len(arena.chi) >= 1001
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+@pytest.mark.parametrize("d", [-4, 5, -999995])
+def test_kronecker_into_arena_matches_fresh_array(d):
+    arena = ScratchArena(2000, 16)
+    compute_kronecker(-3, 2000, out=arena.chi_table(2000))      # Leftovers of a previous d
+    chi = compute_kronecker(d, 1000, out=arena.chi_table(1000))
+    assert np.shares_memory(chi, arena.chi)
+    assert np.array_equal(chi, compute_kronecker(d, 1000))
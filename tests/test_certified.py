@@ -0,0 +1,94 @@
+import pytest
+import numpy as np
+import mpmath as mp
+
+flint = pytest.importorskip("flint")
+
+from grhverify.base_case import iota, logarithmic_derivative, remainder_term, rhs_constant, SYMMETRY_TOL
+from grhverify.certified import PRECISIONS, _decide, certified_gap, certified_verify, iota_ball, rhs_const_ball, remainder_ball, zero_term_ball
+from grhverify.utils.kronecker_symbol import compute_kronecker
+from grhverify.utils.von_mangoldt import compute_lambda
+
+# ======================== WORKING CONSTANTS ========================
+
+mp.dps = 50
+ETAS   = [0.5, 1.5, 6.0, 20.0]
+D, K_TEST, ETA = -999995, 2000, 6.0
+
+def contains(ball, value: mp.mpf) -> bool:
+    # The ball must enclose the 50-digit mpmath value
+    return mp.mpf(ball.lower().str(30, radius=False)) <= value + mp.mpf("1e-28") and \
+           value - mp.mpf("1e-28") <= mp.mpf(ball.upper().str(30, radius=False))
+
+
+class ListStream:
+    # Stand-in for ZeroStream: a fixed list of ordinates, served by prefix
+    def __init__(self, zeros):
+        self.zeros = list(zeros)
+
+    def take(self, n):
+        return self.zeros[:n]
+
+
+def reference_rhs():
+    chi, lam = compute_kronecker(D, K_TEST), compute_lambda(K_TEST)
+    rhs = rhs_constant(D) + logarithmic_derivative(-1, K_TEST, chi, lam, remainder_bound=True, backend="mpmath")
+    return chi, lam, rhs
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("eta", ETAS)
+def test_iota_ball_encloses_iota(eta):
+    eta2 = mp.mpf(eta) ** 2
+    exact = min(1 / (1 + eta2) + 2 / (4 + eta2), 12 / (9 + 4 * eta2))
+    assert contains(iota_ball(eta), exact)
+    assert abs(iota(mp.mpf(eta)) - exact) < mp.mpf("1e-15")
+
+
+@pytest.mark.parametrize("d", [-3, -999995, 5, 999997])
+def test_rhs_terms_enclose_mpmath(d):
+    E, PI, EULER = mp.e, mp.pi, mp.euler
+    if d < 0:
+        exact = mp.mpf("0.5") * mp.log((abs(d) * E**2) / (4 * PI * E**EULER))
+    else:
+        exact = mp.mpf("0.5") * mp.log(abs(d) / (PI * E**EULER))
+    assert contains(rhs_const_ball(d), exact)
+    assert contains(remainder_ball(-1, 10**5), remainder_term(-1, 10**5))
+
+
+def test_zero_terms_enclose_mpmath():
+    assert contains(zero_term_ball(6.02 - 1e-10, 6.02 + 1e-10), 12 / (9 + 4 * mp.mpf(6.02 + 1e-10) ** 2))
+    assert contains(zero_term_ball(-1e-13, 1e-13, SYMMETRY_TOL), 6 / (9 + 4 * mp.mpf(1e-13) ** 2))
+
+
+def test_certified_gap_sizes_from_the_rhs_ball():
+    chi, lam, rhs = reference_rhs()
+    gap, rhs_ball, proven = certified_gap(D, K_TEST, ETA, chi, lam)
+    assert contains(rhs_ball, rhs)
+    assert abs(gap - float(rhs - 2 * iota(mp.mpf(ETA)))) < 1e-12
+    assert not proven and gap > 0
+
+
+def test_certified_verify_proves_with_the_first_sufficient_zero():
+    chi, lam, rhs = reference_rhs()
+    zeros = [0.25 * j for j in range(1, 41)]
+    success, N, prec = certified_verify(D, K_TEST, ETA, 1e-9, ListStream(zeros), chi, lam, chunk=4)
+    assert success and prec == PRECISIONS[0]
+
+    # N is the first prefix whose lower end crosses: N - 1 zeros do not
+    terms = [12 / (9 + 4 * mp.mpf(g + 1e-9) ** 2) for g in zeros]
+    lhs0 = 2 * iota(mp.mpf(ETA))
+    assert lhs0 + mp.fsum(terms[:N]) > rhs >= lhs0 + mp.fsum(terms[:N - 1])
+
+
+def test_certified_verify_reports_too_few_zeros():
+    chi, lam, _ = reference_rhs()
+    success, N, prec = certified_verify(D, K_TEST, ETA, 1e-9, ListStream([1e3, 2e3, 3e3]), chi, lam, chunk=2)
+    assert (success, N, prec) == (False, 3, PRECISIONS[0])
+
+
+def test_straddling_prefix_does_not_stop_the_pass():
+    # 2 iota - rhs straddles 0 at N = 0; the first zero then makes it certain at the same precision
+    rhs, lhs0 = flint.arb(1, 0.05), flint.arb("0.97")
+    assert _decide(rhs, lhs0, 1e-9, [0.1]) == (True, 1)
+    assert _decide(rhs, lhs0, 1e-9, [1e6]) == (None, 1)
@@ -0,0 +1,21 @@
+from grhverify.utils.checkpoint import CheckpointJournal, completed_from_summary
+
+# ======================= TEST =======================
+
+def test_summary_ignores_header_and_torn_row(tmp_path):
+    summary = tmp_path / "summary.csv"
+    summary.write_text("d,eta,N_needed\n-7,6.0,125\n5,6.0,124\n8,6.")
+    assert completed_from_summary(summary) == {-7, 5}
+    assert completed_from_summary(tmp_path / "missing.csv") == set()
+
+
+def test_journal_round_trip(tmp_path):
+    path = tmp_path / "checkpoint.bin"
+    with CheckpointJournal(path) as journal:
+        for d in (-999995, -3, 5):
+            journal.record(d)
+
+    # A torn trailing record is dropped
+    with open(path, "ab") as f:
+        f.write(b"\x01\x02\x03")
+    assert CheckpointJournal(path).load() == {-999995, -3, 5}
@@ -0,0 +1,55 @@
+import numpy as np
+
+from grhverify.utils.data_store import StoreWriter, StoreReader, DataStore, store_path
+
+LO, HI = -40, -3
+K      = 1000
+EPS    = 1e-10
+
+# ======================= TEST =======================
+
+def test_round_trip_and_lookup(tmp_path):
+    zeros = {-4: [6.0209, 10.2438], -8: [4.8937], -3: [8.0397, 11.2492, 15.7046]}
+
+    writer = StoreWriter(tmp_path, LO, HI, K, EPS)
+    for d, z in zeros.items():
+        writer.add(d, np.array(z), eta=z[0] + 2 * EPS, N_used=len(z), success=True)
+    assert writer.close() == store_path(tmp_path, LO, HI)
+
+    reader = StoreReader(store_path(tmp_path, LO, HI))
+    assert (reader.K, reader.eps, reader.lo, reader.hi) == (K, EPS, LO, HI)
+    assert list(reader.index["d"]) == sorted(zeros)
+    for d, z in zeros.items():
+        assert np.array_equal(reader.zeros(d), z)
+        assert reader.record(d)["N_used"] == len(z)
+        assert np.allclose(reader.intervals(d)[:, 1] - reader.intervals(d)[:, 0], 2 * EPS)
+    assert -7 not in reader and reader.zeros(-7).size == 0
+
+    assert np.array_equal(DataStore(tmp_path).zeros(-3), zeros[-3])
+
+
+def test_rewrite_keeps_untouched_records(tmp_path):
+    with StoreWriter(tmp_path, LO, HI, K, EPS) as writer:
+        writer.add(-4, np.array([6.0209]), 6.1, 1, True)
+        writer.add(-8, np.array([4.8937]), 4.9, 1, False)
+
+    # A resumed block recomputes only -8
+    with StoreWriter(tmp_path, LO, HI, K, EPS) as writer:
+        writer.add(-8, np.array([4.8937, 7.1]), 7.2, 2, True)
+
+    reader = StoreReader(store_path(tmp_path, LO, HI))
+    assert reader.record(-8)["success"] and reader.zeros(-8).size == 2
+    assert np.array_equal(reader.zeros(-4), [6.0209])
+
+
+def test_rerun_with_other_parameters_gets_its_own_file(tmp_path):
+    with StoreWriter(tmp_path, LO, HI, K, EPS) as writer:
+        writer.add(-4, np.array([6.0209]), 6.1, 1, True)
+    with StoreWriter(tmp_path, LO, HI, 2 * K, EPS) as writer:
+        writer.add(-8, np.array([4.8937]), 4.9, 1, True)
+
+    # The first file keeps its K and only its own records; the rerun's file carries nothing over
+    first, rerun = StoreReader(store_path(tmp_path, LO, HI)), StoreReader(store_path(tmp_path, LO, HI, 2 * K, EPS))
+    assert first.K == K and list(first.index["d"]) == [-4]
+    assert rerun.K == 2 * K and list(rerun.index["d"]) == [-8]
+    assert np.array_equal(DataStore(tmp_path).zeros(-4), [6.0209])
@@ -0,0 +1,54 @@
+import pytest
+
+from grhverify.native import AVAILABLE
+from grhverify.utils.discriminant import (
+    is_fundamental_discriminant,
+    is_square_free,
+    fundamental_discriminant_segment,
+    fundamental_discriminants,
+)
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("lo, hi", [(-2000, 2000), (999000, 1001000), (-1000300, -999700), (5, 5), (0, 0)])
+def test_sieve_matches_trial_division(lo, hi):
+    expected = [d for d in range(lo, hi + 1) if is_fundamental_discriminant(d)]
+    assert fundamental_discriminant_segment(lo, hi).tolist() == expected
+
+
+def test_stream_is_segment_independent():
+    expected = [d for d in range(-5000, 5001) if is_fundamental_discriminant(d)]
+    assert list(fundamental_discriminants(-5000, 5000, segment=97)) == expected
+
+
+def reference_fundamental(d):
+    # Trial division by every p up to sqrt|d|, independent of the native test
+    def square_free(n):
+        n, p = abs(n), 2
+        while p * p <= n:
+            if n % (p * p) == 0:
+                return False
+            p += 1
+        return n != 0
+    if d % 4 == 1:
+        return square_free(d)
+    return d % 4 == 0 and (d // 4) % 4 in (2, 3) and square_free(d // 4)
+
+
+def test_large_segment_crosses_out_squares_above_sieve_limit():
+    # 65537 is the first prime past SIEVE_LIMIT: its square is only caught by the per-d test
+    for d in (65537 ** 2 * 5, 4 * 65537 ** 2 * 2):
+        segment = fundamental_discriminant_segment(d - 100, d + 100).tolist()
+        assert d not in segment
+        assert segment == [x for x in range(d - 100, d + 101) if reference_fundamental(x)]
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+def test_native_test_at_64_bit_conductors():
+    p, q = 10**18 + 3, 1000003          # both prime
+    assert is_fundamental_discriminant(-p)
+    assert not is_fundamental_discriminant(q * q * 1000001)
+    assert is_fundamental_discriminant(-4 * 1000000007 * 2) and not is_fundamental_discriminant(4 * q * q * 2)
+    assert not is_square_free(2**62) and is_square_free(2**64 - 1)
+    segment = fundamental_discriminant_segment(-p - 4, -p + 4).tolist()
+    assert -p in segment and segment == [d for d in range(-p - 4, -p + 5) if is_fundamental_discriminant(d)]
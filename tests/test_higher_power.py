@@ -0,0 +1,110 @@
+import pytest
+import numpy as np
+import mpmath as mp
+
+from grhverify.higher_power import admissible_height, default_delta, iota, logarithmic_derivative, series_tail, weighted_lambda, window_prefix_lower, zero_tail, zero_term
+from grhverify.native import AVAILABLE
+
+# ======================== WORKING CONSTANTS ========================
+
+mp.dps = 30            # Working precision of the reference path
+K      = 2000          # Truncating limit of the series
+
+# ======================== HELPER: SYNTHETIC TABLES ========================
+
+def lambda_table(K: int) -> np.ndarray:
+    # Plain sieve so the test does not depend on Sage
+    lam = np.zeros(K + 1, dtype=float)
+    is_prime = np.ones(K + 1, dtype=bool)
+    is_prime[:2] = False
+    for p in range(2, K + 1):
+        if not is_prime[p]:
+            continue
+        is_prime[p * p::p] = False
+        q = p
+        while q <= K:
+            lam[q] = np.log(p)
+            q *= p
+    return lam
+
+
+def chi_minus_4(K: int) -> np.ndarray:
+    # Kronecker symbol (-4 | n): 0, 1, 0, -1 repeating
+    return np.resize(np.array([0, 1, 0, -1], dtype=np.int8), K + 1)
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("k, delta", [(2, -1), (2, -3), (4, -2)])
+def test_series_tail_bounds_the_next_terms(k, delta):
+    lam = lambda_table(16 * K)
+    weights = weighted_lambda(16 * K, k, lam)
+    n = np.arange(K + 1, 16 * K + 1, dtype=float)
+    partial = float(np.sum(weights[K + 1:] / n ** (1 - delta)))
+    assert partial <= series_tail(k, delta, K)
+
+
+def test_series_tail_covers_the_rising_terms():
+    # σ = 11, k = 50: f(x) = (log x)^49 / x^11 rises up to x0 = e^(49/11) ≈ 86, beyond K = 20
+    k, delta, K_small, N = 50, -10, 20, 20000
+    weights = weighted_lambda(N, k, lambda_table(N))
+    n = np.arange(K_small + 1, N + 1, dtype=float)
+    partial = float(np.sum(weights[K_small + 1:] / n ** (1 - delta)))
+    assert partial <= series_tail(k, delta, K_small)
+
+
+@pytest.mark.parametrize("k", [2, 4])
+def test_series_brackets_the_kth_derivative_of_log_L(k):
+    # (log L)^(k)(σ, χ_{-4}) by numerical differentiation of mpmath's Dirichlet L-function
+    delta = -2
+    exact = mp.diff(lambda s: mp.log(mp.dirichlet(s, [0, 1, 0, -1])), mp.mpf(1 - delta), k)
+    lower = logarithmic_derivative(k, delta, K, chi_minus_4(K), lambda_table(K), backend="mpmath")
+    assert lower <= exact <= lower + 2 * series_tail(k, delta, K)
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+def test_native_matches_reference():
+    lam, chi = lambda_table(K), chi_minus_4(K)
+    native = logarithmic_derivative(2, -1, K, chi, lam, remainder_bound=False, backend="native")
+    reference = logarithmic_derivative(2, -1, K, chi, lam, remainder_bound=False, backend="mpmath")
+    assert native <= reference and reference - native < mp.mpf("1e-12")
+
+
+def test_window_terms_are_positive_and_decreasing():
+    k, delta = 2, default_delta(2, 3.0)
+    window = admissible_height(k, delta)
+    assert 3.0 <= window / 2
+
+    heights = [window * j / 10 for j in range(11)]
+    terms = [zero_term(t, k, delta) for t in heights]
+    assert all(a > b for a, b in zip(terms, terms[1:])) and terms[-1] > 0
+    assert iota(3.0, k, delta) > 0 and abs(iota(window, k, delta)) < mp.mpf("1e-20")
+
+
+@pytest.mark.parametrize("k, delta", [(2, -2), (4, -3), (10, -7)])
+def test_cached_tail_bounds_the_quadrature(k, delta):
+    # Direct quadrature of N⁺(t) (-h'(t)) for each q: the cached closed form may only be larger, and not by much
+    T = admissible_height(k, delta)
+    c2 = mp.mpf(delta) ** 2
+    assert T > 1
+    for q in (3, 8, 10**9):
+        main = lambda t: t / mp.pi * mp.log(q * t / (2 * mp.pi * mp.e))
+        error = lambda t: (mp.mpf("0.22737") * mp.log(q * (t + 2) / (2 * mp.pi))
+                           + 2 * mp.log(1 + mp.log(q * (t + 2) / (2 * mp.pi))) - mp.mpf("0.5"))
+        integral = mp.quad(lambda t: (main(t) + error(t)) * k * t * mp.power(c2 + t * t, -mp.mpf(k) / 2 - 1), [T, 2 * T, mp.inf])
+        reference = -mp.power(c2 + T * T, -mp.mpf(k) / 2) * max(0, main(T) - error(T)) + integral
+        assert reference <= zero_tail(q, k, delta, T) <= reference * mp.mpf("1.2")
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+@pytest.mark.parametrize("k, delta", [(2, -1), (4, -3), (20, -12)])
+def test_native_window_prefix_matches_reference(k, delta):
+    window, eps = admissible_height(k, delta), 1e-9
+    zeros = float(window) * np.array([0.0, 0.1, 0.35, 0.6, 0.9, 1.1])
+    prefix = window_prefix_lower(zeros, eps, k, delta, window)
+    assert len(prefix) == 5
+
+    total = mp.mpf(0)
+    for gamma, lower in zip(zeros, prefix):
+        symmetric = abs((gamma - eps) + (gamma + eps)) <= 1e-12
+        total += zero_term(mp.mpf(gamma + eps), k, delta, symmetric)
+        assert lower <= total and total - lower < mp.mpf("1e-10") * total
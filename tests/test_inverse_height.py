@@ -0,0 +1,50 @@
+import pytest
+import numpy as np
+import mpmath as mp
+
+from grhverify.base_case import iota, iota_lower, max_height, max_verified_eta, zero_prefix_lower
+from grhverify.native import AVAILABLE
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("bound", ["0.001", "0.3", "1", "1.3", "1.333"])
+def test_max_height_inverts_iota(bound):
+    bound = mp.mpf(bound)
+    eta = max_height(bound)
+    assert iota(eta * (1 - mp.mpf("1e-20"))) > bound
+    assert iota(eta * (1 + mp.mpf("1e-20"))) <= bound
+
+
+def test_max_height_limits():
+    assert max_height(mp.mpf(0)) == mp.inf
+    assert max_height(mp.mpf(4) / 3) is None
+
+
+def test_max_verified_eta_is_tight():
+    zeros = 1.0 + 0.75 * np.arange(80)          # C(Z)_80 ≈ 3.05
+    eps = 1e-8
+    contribution = sum(12 / (9 + 4 * mp.mpf(float(g) + eps) ** 2) for g in zeros)
+    rhs = contribution + 2 * iota(mp.mpf(5))
+
+    eta = max_verified_eta(-3, zeros, eps, rhs, backend="mpmath")
+    assert abs(eta - 5) < 1e-9
+    assert 2 * iota(mp.mpf(eta)) + contribution > rhs
+    assert not 2 * iota(mp.mpf(eta) * (1 + mp.mpf("1e-12"))) + contribution > rhs
+
+    # Fewer zeros verify a smaller height; none at all cannot close this gap
+    assert max_verified_eta(-3, zeros[:40], eps, rhs, backend="mpmath") < eta
+    assert max_verified_eta(-3, zeros[:0], eps, rhs, backend="mpmath") is None
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+def test_native_inverse_agrees_with_the_forward_test():
+    zeros = 1.0 + 0.75 * np.arange(80)
+    eps = 1e-8
+    contribution = mp.mpf(float(zero_prefix_lower(zeros, eps)[-1]))
+    rhs = contribution + 2 * iota(mp.mpf(5))
+
+    # The forward mode certifies with iota_lower: eta passes it and the next float does not
+    eta = max_verified_eta(-3, zeros, eps, rhs, backend="native")
+    assert abs(eta - 5) < 1e-9
+    assert 2 * iota_lower([eta], backend="native")[0] + contribution > rhs
+    assert not 2 * iota_lower([np.nextafter(eta, np.inf)], backend="native")[0] + contribution > rhs
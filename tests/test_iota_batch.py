@@ -0,0 +1,74 @@
+import bisect
+
+import pytest
+import numpy as np
+import mpmath as mp
+
+from grhverify.base_case import iota, iota_lower, first_crossings, zero_prefix_lower, PRECISION_POLICIES
+from grhverify.native import AVAILABLE, _native
+
+# ======================== WORKING CONSTANTS ========================
+
+mp.dps = 50
+ETAS = np.concatenate(([0.0, 1e-9, 1.0, 2.0, 1e4], np.random.default_rng(3).uniform(0.0, 40.0, size=300)))
+
+pytestmark = pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("policy", PRECISION_POLICIES)
+def test_iota_enclosures_contain_mpmath(policy):
+    hi, lo, rad = (np.empty_like(ETAS) for _ in range(3))
+    _native.iota_batch(ETAS, policy, hi, lo, rad)
+    for eta, h, l, r in zip(ETAS, hi, lo, rad):
+        exact = iota(mp.mpf(float(eta)))
+        centre = mp.mpf(float(h)) + mp.mpf(float(l))
+        assert abs(exact - centre) <= r
+        assert r <= (1e-30 if policy == "dd" else 1e-15) * exact
+
+
+def test_iota_lower_is_a_lower_bound():
+    lower = iota_lower(ETAS.tolist())
+    exact = iota_lower(ETAS.tolist(), backend="mpmath")
+    assert all(a <= b and b - a <= 1e-30 * b for a, b in zip(lower, exact))
+    with pytest.raises(ValueError):
+        iota_lower([1.0], policy="quad")
+
+
+@pytest.mark.parametrize("policy", PRECISION_POLICIES)
+def test_zero_prefix_policies_bound_the_exact_sum(policy):
+    zeros = np.sort(np.random.default_rng(5).uniform(0.1, 300.0, size=2000))
+    eps = 1e-6
+    prefix = zero_prefix_lower(zeros, eps, policy=policy)
+    if policy == "double":
+        assert prefix.tolist() == zero_prefix_lower(zeros, eps).tolist()
+    exact = mp.mpf(0)
+    for i, z in enumerate(zeros):
+        g = mp.mpf(float(z + eps))
+        exact += 12 / (9 + 4 * g * g)
+        if i % 250 == 0:
+            assert mp.mpf(float(prefix[i])) <= exact
+    assert exact - mp.mpf(float(prefix[-1])) < 1e-11
+    assert np.all(np.diff(prefix) >= 0)
+
+
+class _ListStream:
+    # Minimal ZeroStream stand-in: a fixed list of zeros
+    def __init__(self, zeros):
+        self.zeros = list(zeros)
+
+    def take(self, count):
+        return self.zeros[:count]
+
+
+def test_double_screen_matches_mpmath_bisection():
+    # RHS placed exactly on prefix values: the crossing is decided by the mpmath fallback
+    zeros = np.sort(np.random.default_rng(7).uniform(0.5, 100.0, size=300))
+    stream = _ListStream(zeros)
+    prefix = zero_prefix_lower(zeros, 1e-8)
+    lhs0s = [mp.mpf(1), mp.mpf("0.5"), mp.mpf(0)]
+    for rhs in (mp.mpf(prefix[50]) + 1, mp.mpf(prefix[120]) + mp.mpf("0.5"), mp.mpf(2)):
+        found = first_crossings(stream, 1e-8, lhs0s, rhs, chunk=8)
+        for lhs0, (success, N) in zip(lhs0s, found):
+            expected = bisect.bisect_left(range(len(zeros)), True, key=lambda i: lhs0 + mp.mpf(prefix[i]) > rhs)
+            assert (success, N) == ((True, expected + 1) if expected < len(zeros) else (False, len(zeros)))
@@ -0,0 +1,56 @@
+import pytest
+import numpy as np
+
+from grhverify.native import AVAILABLE, _native
+from grhverify.utils.kronecker_symbol import compute_kronecker, kronecker_matrix
+
+# ======================== WORKING CONSTANTS ========================
+
+K = 5000
+
+pytestmark = pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+
+# ==================== HELPER: REFERENCE KRONECKER =====================
+
+def reference_kronecker(a: int, n: int) -> int:
+    # Product of Legendre symbols over the factorisation of n (Euler's criterion, (a|2) by a mod 8)
+    if n == 0:
+        return 1 if abs(a) == 1 else 0
+    result, p = 1, 2
+    while n > 1:
+        if p * p > n:
+            p = n
+        while n % p == 0:
+            if p == 2:
+                result *= 0 if a % 2 == 0 else (1 if a % 8 in (1, 7) else -1)
+            else:
+                v = pow(a % p, (p - 1) // 2, p)
+                result *= -1 if v == p - 1 else v
+            n //= p
+        p += 1
+    return result
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("d", [-4, -3, 5, 8, -7, 12, -999995, 999993, -99995])
+def test_table_matches_reference(d):
+    chi = compute_kronecker(d, K, backend="native")
+    assert chi.dtype == np.int8 and chi[0] == 0
+    assert all(chi[k] == reference_kronecker(d, k) for k in range(1, K + 1))
+
+
+def test_matrix_matches_table():
+    ds = [-999995, -3, 5, 13, 1000]
+    ks = np.array([2, 3, 4, 5, 7, 8, 9, 11, 4999], dtype=np.int64)
+    chi_mat = kronecker_matrix(ds, ks, backend="native")
+    for b, d in enumerate(ds):
+        assert np.array_equal(chi_mat[:, b], compute_kronecker(d, K, backend="native")[ks])
+
+
+def test_scalar_rejects_negative_n():
+    # n used to be parsed as unsigned, so -1 wrapped to 2^64 - 1 and returned a symbol
+    assert _native.kronecker(5, 2**64 - 1) == reference_kronecker(5, 2**64 - 1)
+    with pytest.raises(ValueError):
+        _native.kronecker(-4, -1)
+    with pytest.raises(OverflowError):
+        _native.kronecker(-4, 2**64)
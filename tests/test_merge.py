@@ -0,0 +1,75 @@
+import os
+
+import numpy as np
+
+from grhverify import merge
+from grhverify.merge import coverage_gaps, lookup, merge_errors, merge_rows, merged_ds, shard_rows, write_merged
+from grhverify.utils.data_store import StoreWriter
+from grhverify.utils.results_sink import ResultsSink
+
+# ======================== HELPER: SHARDS ========================
+
+def make_shard(root, rows, stored=(), errors=(), mtime=0):
+    # Summary rows through the real sink, store records through StoreWriter, then a fixed modification time
+    output, data = root / "results", root / "data"
+    with ResultsSink(output) as sink:
+        for d, eta, N in rows:
+            sink.add(d, eta, N, error=errors.get(d) if errors else None)
+    if stored:
+        with StoreWriter(data, -100, 100, 10**5, 1e-6) as store:
+            for d, eta, N, success in stored:
+                store.add(d, np.arange(1.0, N + 1.0), eta, N, success)
+    for path in [*output.iterdir(), *(data / "store").glob("*.grh")] if stored else output.iterdir():
+        os.utime(path, ns=(mtime, mtime))
+    return output, data
+
+# ======================= TEST =======================
+
+def test_reruns_are_deduplicated_by_policy(tmp_path):
+    a = make_shard(tmp_path / "a", [(-3, 6.0, 1), (-4, 6.0, 2), (5, 6.0, 2)], stored=[(-4, 6.0, 2, True)], mtime=10**18)
+    b = make_shard(tmp_path / "b", [(-4, 6.0, 3), (8, 6.0, 1), (-4, 2.0, 1)],
+                   errors={-4: "Error: d = -4, N = 3, reason = boom"}, mtime=2 * 10**18)
+    streams = lambda: [shard_rows(*a), shard_rows(*b)]
+
+    assert [row.d for row in shard_rows(*b)] == [-4, -4, 8]
+    recent = list(merge_rows(streams(), "recent"))
+    assert [(row.d, row.eta, row.N_needed) for row in recent] == [(-4, 2.0, 1), (-4, 6.0, 3), (-3, 6.0, 1), (5, 6.0, 2), (8, 6.0, 1)]
+
+    rigorous = {(row.d, row.eta): row for row in merge_rows(streams(), "rigorous")}
+    assert rigorous[(-4, 6.0)].N_needed == 2 and rigorous[(-4, 6.0)].success is True
+    assert rigorous[(-3, 6.0)].success is None
+
+    out = tmp_path / "merged"
+    assert write_merged(out, recent) == 4 and list(merged_ds(out)) == [-4, -3, 5, 8]
+    assert merge_errors([a[0], b[0], b[0]], out) == 1
+    # The merged directory is itself a shard: merging it again changes nothing
+    assert [(row.key, row.success) for row in shard_rows(out)] == [(row.key, row.success) for row in recent]
+
+
+def test_unsorted_shards_are_sorted_through_spilled_runs(tmp_path, monkeypatch):
+    rows = [(d, 6.0, -d) for d in (-5, -40, -3, -7, -8, -4, -20, -11, -19)]
+    shard = make_shard(tmp_path / "a", rows, stored=[(-8, 6.0, 8, True), (-99, 2.0, 1, False)], mtime=10**18)
+    in_memory = list(shard_rows(*shard))
+
+    monkeypatch.setattr(merge, "RUN_ROWS", 2)
+    spilled = list(shard_rows(*shard))
+    assert spilled == in_memory
+    assert [row.d for row in spilled] == [-99, -40, -20, -19, -11, -8, -7, -5, -4, -3]
+    assert spilled[0].order[1] == -1 and spilled[5].success is True
+
+
+def test_index_lookup(tmp_path, monkeypatch):
+    monkeypatch.setattr(merge, "INDEX_STRIDE", 3)
+    rows = [merge.MergedRow(d, eta, 10**5, 1e-6, 1, True, (0, 0), "") for d in range(-40, 0) for eta in (2.0, 6.0)]
+    write_merged(tmp_path, rows)
+    assert len(np.fromfile(tmp_path / "summary.idx", dtype="<i8")) == 2 * 27
+    for d in (-40, -23, -1):
+        assert [(row.d, row.eta) for row in lookup(tmp_path, d)] == [(d, 2.0), (d, 6.0)]
+    assert lookup(tmp_path, 7) == [] and lookup(tmp_path, -41) == []
+
+
+def test_coverage_gaps_are_runs_of_missing_fundamental_discriminants():
+    # Fundamental d in [-20, -1]: -20, -19, -15, -11, -8, -7, -4, -3
+    assert coverage_gaps([-20, -11, -3], -20, -1) == [(-19, -15, 2), (-8, -4, 3)]
+    assert coverage_gaps([-7, -4, -3], -20, -1, segment=5) == [(-20, -8, 5)]
+    assert coverage_gaps([], -8, -7) == [(-8, -7, 2)]
@@ -0,0 +1,38 @@
+import time
+
+import pytest
+
+from grhverify.utils.metrics import COLUMNS, Metrics, MetricsReport, begin, current
+
+# ======================= TEST =======================
+
+def test_nested_stages_are_exclusive():
+    metrics = Metrics()
+    with metrics.stage("lhs"):
+        with metrics.stage("lcalc"):
+            time.sleep(0.02)
+    assert metrics.times["lcalc"] >= 0.02
+    assert metrics.times["lhs"] < 0.01
+
+
+def test_stage_passes_exceptions_through():
+    metrics = Metrics()
+    with pytest.raises(StopIteration):
+        with metrics.stage("lhs"):
+            raise StopIteration
+    assert metrics.times["lhs"] >= 0.0 and metrics._inner == []
+
+
+def test_snapshot_and_report():
+    metrics = begin()
+    assert metrics is current()
+    metrics.count("lcalc_calls")
+    metrics.count("zeros_used", 12)
+    snapshot = metrics.snapshot()
+    assert tuple(snapshot) == COLUMNS
+
+    report = MetricsReport()
+    report.add(snapshot)
+    report.add(begin().snapshot())
+    assert report.totals["zeros_used"] == 12
+    assert report.lines()[0] == "Metrics over 2 discriminants"
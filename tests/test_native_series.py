@@ -0,0 +1,127 @@
+import pytest
+import numpy as np
+import mpmath as mp
+
+from grhverify.base_case import first_crossing, first_crossings, _reference_crossings, logarithmic_derivative, partial_series, remainder_term, prime_power_weights, zero_prefix_lower, SYMMETRY_TOL
+from grhverify.native import AVAILABLE, _native
+
+# ======================== WORKING CONSTANTS ========================
+
+mp.dps = 50            # Working precision of the reference path
+K      = 20000         # Truncating limit for L'/L
+
+pytestmark = pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+
+# ======================== HELPER: SYNTHETIC TABLES ========================
+
+def lambda_table(K: int) -> np.ndarray:
+    # Plain sieve so the test does not depend on Sage
+    lam = np.zeros(K + 1, dtype=float)
+    is_prime = np.ones(K + 1, dtype=bool)
+    is_prime[:2] = False
+    for p in range(2, K + 1):
+        if not is_prime[p]:
+            continue
+        is_prime[p * p::p] = False
+        q = p
+        while q <= K:
+            lam[q] = np.log(p)
+            q *= p
+    return lam
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("seed", [0, 1, 2])
+@pytest.mark.parametrize("delta", [-1, -3])
+def test_native_matches_mpmath(seed, delta):
+    rng = np.random.default_rng(seed)
+    chi = rng.integers(-1, 2, size=K + 1).astype(np.int8)
+    lam = lambda_table(K)
+
+    reference = logarithmic_derivative(delta, K, chi, lam, remainder_bound=True, backend="mpmath")
+    native    = logarithmic_derivative(delta, K, chi, lam, remainder_bound=True, backend="native")
+
+    # Native returns the certified upper end: never below the reference, and within ~1e-15
+    assert native >= reference - mp.mpf("1e-40")
+    assert native - reference < mp.mpf("1e-14")
+
+
+def test_extended_partial_sum_matches_full_sum():
+    rng = np.random.default_rng(3)
+    chi = rng.integers(-1, 2, size=K + 1).astype(np.int8)
+    lam = lambda_table(K)
+
+    # Head up to 2000 extended over (2000, K]: same value as one pass, up to the two rounding bounds
+    head = partial_series(-1, 1, 2000, chi, lam, backend="native")
+    tail = partial_series(-1, 2001, K, chi, lam, backend="native")
+    full = logarithmic_derivative(-1, K, chi, lam, remainder_bound=False, backend="native")
+    assert abs(head + tail - full) < mp.mpf("1e-14")
+
+    # The truncation at 2000 differs from the one at K by less than the tail bound
+    assert abs(head - full) <= remainder_term(-1, 2000)
+
+
+@pytest.mark.parametrize("B", [1, 63, 130])
+def test_sparse_batch_matches_dense(B):
+    rng = np.random.default_rng(B)
+    lam = lambda_table(K)
+    chis = rng.integers(-1, 2, size=(B, K + 1)).astype(np.int8)
+
+    # Shared weights over prime powers, χ matrix laid out (prime powers x discriminants)
+    k_idx, w, w_err = prime_power_weights(K, lam, -1)
+    chi_mat = np.ascontiguousarray(chis[:, k_idx].T)
+    hi, lo, err = np.empty(B), np.empty(B), np.empty(B)
+    _native.sparse_series_batch(chi_mat, w, w_err, hi, lo, err)
+
+    for b in range(B):
+        d_hi, d_lo, d_err = _native.dense_series(chis[b], lam, K, 2)
+        assert abs((hi[b] - d_hi) + (lo[b] - d_lo)) <= err[b] + d_err
+
+
+@pytest.mark.parametrize("eps", [1e-10, 0.0])
+def test_zero_prefix_lower_bounds_mpmath_sum(eps):
+    rng = np.random.default_rng(7)
+    zeros = np.sort(rng.uniform(0.0, 150.0, size=300))
+    zeros[0] = 0.0          # Type 2 interval
+
+    prefix = zero_prefix_lower(zeros, eps)
+    assert np.all(np.diff(prefix) >= 0)
+
+    # Same contributions as the mpmath loop of base_case_verify
+    total = mp.mpf(0)
+    for n, gamma in enumerate(zeros):
+        gamma_minus, gamma_plus = mp.mpf(gamma - eps), mp.mpf(gamma + eps)
+        if mp.almosteq(gamma_minus + gamma_plus, 0, rel_eps=0, abs_eps=SYMMETRY_TOL):
+            total += 6 / (9 + 4 * gamma_plus * gamma_plus)
+        else:
+            total += 12 / (9 + 4 * gamma_plus * gamma_plus)
+        assert mp.mpf(prefix[n]) <= total
+        assert total - mp.mpf(prefix[n]) < total * mp.mpf("1e-13")
+
+
+class _ListStream:
+    # Minimal ZeroStream stand-in: a fixed list of zeros
+    def __init__(self, zeros):
+        self.zeros = list(zeros)
+
+    def take(self, count):
+        return self.zeros[:count]
+
+    def __iter__(self):
+        return iter(self.zeros)
+
+
+def test_shared_crossings_match_single_targets():
+    rng = np.random.default_rng(3)
+    stream = _ListStream(np.sort(rng.uniform(0.5, 200.0, size=400)))
+    rhs = mp.mpf(2)
+    lhs0s = [mp.mpf(x) for x in (1.9, 1.5, 0.5, -5.0)]     # The last one never crosses
+
+    shared = first_crossings(stream, 1e-8, lhs0s, rhs, chunk=4)
+    assert shared == [first_crossing(stream, 1e-8, lhs0, rhs, chunk=4) for lhs0 in lhs0s]
+    assert shared[-1] == (False, 400)
+    assert [N for _, N in shared[:3]] == sorted(N for _, N in shared[:3])
+
+    # The mpmath path agrees except where a crossing lands within rounding of the RHS
+    reference = _reference_crossings(stream, 1e-8, lhs0s, rhs, chunk=4)
+    assert all(abs(a[1] - b[1]) <= 1 and a[0] == b[0] for a, b in zip(shared, reference))
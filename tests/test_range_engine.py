@@ -0,0 +1,26 @@
+import pytest
+import mpmath as mp
+
+from grhverify.base_case import logarithmic_derivative_batch
+from grhverify.native import AVAILABLE
+from grhverify.range_engine import logarithmic_derivative_range
+from grhverify.utils.von_mangoldt import compute_lambda
+
+# ======================== WORKING CONSTANTS ========================
+
+K = 20000
+
+pytestmark = pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+
+# ======================= TEST =======================
+
+@pytest.mark.parametrize("d_min, d_max, segment", [(-2000, -1000, 1 << 16), (5, 3000, 257), (-999995, -999000, 100)])
+def test_range_matches_batch(d_min, d_max, segment):
+    lam = compute_lambda(K)
+    values = logarithmic_derivative_range(d_min, d_max, K, lambda_arr=lam, segment=segment)
+    ds = sorted(values)
+    reference = logarithmic_derivative_batch(ds, K, lambda_arr=lam, backend="native")
+
+    # Both are certified upper ends of the same sum: they agree to the size of their error bounds
+    for d, ref in zip(ds, reference):
+        assert abs(values[d] - ref) < mp.mpf("1e-14")
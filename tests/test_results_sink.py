@@ -0,0 +1,38 @@
+import gzip
+
+from grhverify.utils.checkpoint import CheckpointJournal
+from grhverify.utils.results_sink import ResultsSink, completed_from_outputs, summary_rows
+
+# ======================= TEST =======================
+
+def test_rows_are_batched_and_journaled_after_the_summary(tmp_path):
+    journal = CheckpointJournal(tmp_path / "checkpoint.bin")
+    sink = ResultsSink(tmp_path, flush_rows=3, flush_seconds=1e9, journal=journal)
+
+    sink.add(-3, 6.0, 1)
+    sink.add(-4, 6.0, 1, error="Error: d = -4, N = 0, reason = boom")
+    assert not (tmp_path / "summary.csv").exists() and journal.load() == set()
+
+    sink.add(5, 6.0, 2)        # Third row: one batched write
+    sink.add(8, 6.0, 3)
+    assert (tmp_path / "summary.csv").read_text().splitlines() == ["d,eta,N_needed", "-3,6.0,1", "-4,6.0,1", "5,6.0,2"]
+    assert journal.load() == {-3, -4, 5}
+    assert "d = -4" in (tmp_path / "errors.log").read_text()
+
+    sink.close()               # Pending row written on shutdown
+    journal.close()
+    assert completed_from_outputs(tmp_path) == {-3, -4, 5, 8}
+
+
+def test_gzip_backend_survives_a_torn_member(tmp_path):
+    with ResultsSink(tmp_path, summary_format="csv.gz", flush_rows=2) as sink:
+        for d in (-3, -4, 5, 8):
+            sink.add(d, 6.0, 1)
+    assert sink.flushes == 2
+
+    # A crash mid-write leaves a truncated last member: earlier rows still count
+    path = tmp_path / "summary.csv.gz"
+    with open(path, "ab") as f:
+        f.write(gzip.compress(b"12,6.0,5\n13,6.0,5\n")[:-6])
+    assert completed_from_outputs(tmp_path) == {-3, -4, 5, 8}
+    assert list(summary_rows(tmp_path)) == [(-3, 6.0, 1), (-4, 6.0, 1), (5, 6.0, 1), (8, 6.0, 1)]
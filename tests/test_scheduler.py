@@ -0,0 +1,44 @@
+import pytest
+
+from pathlib import Path
+
+from grhverify.scheduler import SweepConfig, d_blocks, shard_blocks, parse_shard, parse_targets
+
+# ======================= TEST =======================
+
+def test_blocks_cover_range():
+    blocks = list(d_blocks(-10, 10, 4))
+    assert blocks[0] == (-10, -7) and blocks[-1] == (10, 10)
+    covered = [d for lo, hi in blocks for d in range(lo, hi + 1)]
+    assert covered == list(range(-10, 11))
+
+
+def test_shards_partition_blocks():
+    blocks = list(d_blocks(-1000, 1000, 37))
+    shards = [list(shard_blocks(blocks, i, 3)) for i in range(3)]
+    assert sorted(b for shard in shards for b in shard) == sorted(blocks)
+    assert all(len(shard) >= len(blocks) // 3 for shard in shards)
+
+
+@pytest.mark.parametrize("text", ["3/3", "-1/2", "1", "a/b"])
+def test_parse_shard_rejects(text):
+    with pytest.raises(ValueError):
+        parse_shard(text)
+
+
+def test_parse_shard():
+    assert parse_shard("2/4") == (2, 4)
+
+
+def test_parse_targets():
+    assert parse_targets("auto, 6,6:1e-4,6", 1e-6) == ((None, 1e-6), (6.0, 1e-6), (6.0, 1e-4))
+    for text in ("6:x", "-1", "6:0"):
+        with pytest.raises(ValueError):
+            parse_targets(text, 1e-6)
+
+
+def test_store_eps_follows_the_first_target():
+    # The store keeps the first target's zeros and outcome, so its header must carry that target's eps
+    base = dict(K=1000, eps=1e-6, lcalc_path=Path("lcalc"), data_dir=Path("data"), log_path=Path("errors.log"))
+    assert SweepConfig(**base).store_eps == 1e-6
+    assert SweepConfig(**base, targets=parse_targets("6:1e-4,auto", 1e-6)).store_eps == 1e-4
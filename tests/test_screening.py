@@ -0,0 +1,30 @@
+import pytest
+import mpmath as mp
+
+from grhverify.base_case import iota, rhs_constant
+from grhverify.native import AVAILABLE
+from grhverify.range_engine import logarithmic_derivative_range
+from grhverify.screening import ScreenRow, screen_block, cost_order
+from grhverify.utils.von_mangoldt import compute_lambda
+
+# ======================= TEST =======================
+
+def test_cost_order_is_longest_first():
+    blocks = [(-30, -21), (-20, -11), (-10, -1), (1, 10)]
+    rows = [ScreenRow(-25, 0.0, 1.0, 5), ScreenRow(-15, 0.0, -1.0, 0), ScreenRow(-3, 0.0, 2.0, 7), ScreenRow(-4, 0.0, 2.0, 1), ScreenRow(5, 0.0, 1.0, 5)]
+    assert cost_order(blocks, rows) == [(-10, -1), (-30, -21), (1, 10)]
+
+
+@pytest.mark.skipif(not AVAILABLE, reason="native extension not built")
+def test_screen_margin_matches_verification_test():
+    K, eta = 20000, 6.0
+    lam = compute_lambda(K)
+    rows = screen_block(-2000, -1000, K, eta, lam, backend="native")
+    series = logarithmic_derivative_range(-2000, -1000, K, lambda_arr=lam)
+    assert [row.d for row in rows] == sorted(series)
+
+    lhs0 = 2 * iota(mp.mpf(eta))
+    for row in rows:
+        rhs = rhs_constant(row.d) + series[row.d]
+        assert (row.predicted == 0) == (lhs0 > rhs)
+        assert abs(row.margin - float(rhs - lhs0)) < 1e-12
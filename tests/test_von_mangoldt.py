@@ -0,0 +1,45 @@
+import math
+import numpy as np
+
+from grhverify.utils import von_mangoldt
+from grhverify.utils.von_mangoldt import compute_lambda, compute_lambda_sparse, lambda_table, load_lambda_bin
+
+# ======================== WORKING CONSTANTS ========================
+
+K = 10000
+
+# ======================= TEST =======================
+
+def test_dense_values():
+    lam = compute_lambda(K)
+    assert lam[0] == 0 and lam[1] == 0
+    assert lam[2] == math.log(2) and lam[1024] == math.log(2)
+    assert lam[9973] == math.log(9973) and lam[6] == 0 and lam[9999] == 0
+
+
+def test_sparse_matches_dense():
+    k_idx, log_p = compute_lambda_sparse(K)
+    lam = compute_lambda(K)
+    assert np.array_equal(k_idx, np.flatnonzero(lam))
+    assert np.array_equal(log_p, lam[k_idx])
+
+
+def test_bin_round_trip_and_cache(tmp_path):
+    von_mangoldt._LAMBDA_CACHE.pop(K, None)
+    table = lambda_table(K, tmp_path)
+    assert lambda_table(K) is table                       # one copy per process
+    assert not table.flags.writeable
+
+    # The table handed out is the mapping itself, not a per-process copy
+    file_K, mapped = load_lambda_bin(tmp_path / "von_mangoldt.bin")
+    assert file_K == K and isinstance(table, np.memmap)
+    assert np.array_equal(mapped, compute_lambda(K)) and np.array_equal(table, mapped)
+
+
+def test_smaller_K_is_a_view_of_the_file(tmp_path):
+    von_mangoldt._LAMBDA_CACHE.pop(K, None)
+    von_mangoldt._LAMBDA_CACHE.pop(K // 2, None)
+    lambda_table(K, tmp_path)
+    half = lambda_table(K // 2, tmp_path)
+    assert isinstance(half, np.memmap) and len(half) == K // 2 + 1
+    assert np.array_equal(half, compute_lambda(K // 2))
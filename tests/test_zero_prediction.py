@@ -0,0 +1,16 @@
+from grhverify.base_case import predicted_zero_count, ZERO_CAP, ZERO_SLACK
+
+# ======================= TEST =======================
+
+def test_prediction_grows_with_gap_and_conductor():
+    assert predicted_zero_count(-3, 0.0) == 1
+    counts = [predicted_zero_count(-999995, gap) for gap in (1.0, 4.0, 5.5, 6.0)]
+    assert counts == sorted(counts) and counts[0] >= ZERO_SLACK
+    assert predicted_zero_count(-999995, 5.5) < predicted_zero_count(-999995, 5.9)
+    assert predicted_zero_count(-999995, 100.0) == ZERO_CAP
+
+
+def test_prediction_matches_zero_counting_function():
+    # Gap closed around T ≈ 29 for |d| = 10^6, where N⁺(T) ≈ 66 zeros
+    count = predicted_zero_count(10**6, 5.9087)
+    assert 66 <= count <= 1.25 * 70 + ZERO_SLACK
@@ -0,0 +1,159 @@
+import sys
+import stat
+import pytest
+import numpy as np
+from pathlib import Path
+
+from grhverify.utils import generate_zeros
+from grhverify.utils.zero_stream import ZeroStream, ZeroBatchFetcher
+from grhverify.utils.zero_cache import ZeroCache
+from grhverify.scheduler import SweepConfig, prefetched_streams
+
+# ==================== HELPER: FAKE LCALC =====================
+
+FAKE_LCALC = """#!{python}
+import sys
+args  = sys.argv[1:]
+count = int(args[args.index("-z") + 1])
+d     = args[args.index("--start") + 1]
+limit = {limit}
+with open({log!r}, "a") as log:
+    log.write(f"{{count}}\\n")
+for n in range(1, min(count, limit) + 1):
+    print(d, 0.5 * n)
+"""
+
+def fake_lcalc(tmp_path: Path, limit: int = 10**6) -> Path:
+    # Emits zeros 0.5, 1.0, 1.5, ... in lcalc's "d gamma" format and logs each requested count
+    exe = tmp_path / "lcalc"
+    exe.write_text(FAKE_LCALC.format(python=sys.executable, limit=limit, log=str(tmp_path / "calls.log")))
+    exe.chmod(exe.stat().st_mode | stat.S_IEXEC)
+    return exe
+
+def launches(tmp_path: Path) -> list[int]:
+    return [int(line) for line in (tmp_path / "calls.log").read_text().split()]
+
+
+class FakeLibrary:
+    # Stand-in for the linked lcalc: zeros 0.5, 1.0, ... up to limit, or an lcalc failure
+    def __init__(self, limit: int, fail: bool = False):
+        self.limit, self.fail = limit, fail
+
+    def lcalc_zeros(self, d, count, out):
+        if self.fail:
+            raise RuntimeError("lcalc: bad character")
+        found = min(count, self.limit)
+        out[:found] = 0.5 * np.arange(1, found + 1)
+        return found
+
+# ======================= TEST =======================
+
+def test_stream_grows_geometrically(tmp_path):
+    with ZeroStream(-3, fake_lcalc(tmp_path), initial=4) as stream:
+        assert stream.take(3).tolist() == [0.5, 1.0, 1.5]
+        assert stream[20] == 10.5
+    assert launches(tmp_path) == [4, 21]
+
+
+def test_prefix_is_not_recomputed(tmp_path):
+    with ZeroStream(5, fake_lcalc(tmp_path), initial=2, prefix=[0.5]) as stream:
+        assert stream.known.tolist() == [0.5]
+        assert stream.take(2).tolist() == [0.5, 1.0]
+    assert launches(tmp_path) == [2]
+
+
+def test_stream_exhausts(tmp_path):
+    with ZeroStream(8, fake_lcalc(tmp_path, limit=5), initial=2) as stream:
+        assert list(stream) == [0.5, 1.0, 1.5, 2.0, 2.5]
+
+
+def test_library_keeps_the_partial_block(monkeypatch):
+    monkeypatch.setattr(generate_zeros, "LCALC_LINKED", True)
+    monkeypatch.setattr(generate_zeros, "_native", FakeLibrary(limit=5))
+    with ZeroStream(-3, "unused", initial=4, engine="library") as stream:
+        assert stream.take(10).tolist() == [0.5, 1.0, 1.5, 2.0, 2.5]
+
+
+def test_library_failure_is_not_exhaustion(monkeypatch):
+    monkeypatch.setattr(generate_zeros, "LCALC_LINKED", True)
+    monkeypatch.setattr(generate_zeros, "_native", FakeLibrary(limit=5, fail=True))
+    with ZeroStream(-3, "unused", initial=4, engine="library") as stream:
+        with pytest.raises(RuntimeError, match="bad character"):
+            stream.take(2)
+
+
+def test_batch_fetcher_demultiplexes(tmp_path):
+    # Fake range run: every d in [start, finish] gets the same zeros, tagged by d
+    exe = tmp_path / "lcalc_range"
+    exe.write_text(f"""#!{sys.executable}
+import sys
+args   = sys.argv[1:]
+count  = int(args[args.index("-z") + 1])
+start  = int(args[args.index("--start") + 1])
+finish = int(args[args.index("--finish") + 1])
+for d in range(start, finish + 1):
+    if d % 4 in (0, 1):
+        for n in range(1, count + 1):
+            print(d, d + 0.5 * n)
+""")
+    exe.chmod(exe.stat().st_mode | stat.S_IEXEC)
+
+    fetcher = ZeroBatchFetcher(exe, 2, width=10, d_max=15)
+    assert fetcher.zeros(5).tolist() == [5.5, 6.0]
+    assert fetcher.zeros(7).tolist() == []
+    assert fetcher.zeros(12).tolist() == [12.5, 13.0]
+    assert fetcher.zeros(15).tolist() == []
+    assert fetcher.launches == 2
+
+
+def test_cache_serves_prefixes_across_runs(tmp_path):
+    exe = fake_lcalc(tmp_path)
+    with ZeroStream(-4, exe, initial=6, cache=ZeroCache(tmp_path / "data")) as stream:
+        assert stream.take(6)[-1] == 3.0
+
+    # A second run (fresh cache object) reads the cached six zeros and only extends the tail
+    cache = ZeroCache(tmp_path / "data")
+    assert list(cache.get(-4, count=4)) == [0.5, 1.0, 1.5, 2.0]
+    assert list(cache.get(-4, height=1.2)) == [0.5, 1.0]
+    assert cache.get(-4, height=3.0) is None
+    with ZeroStream(-4, exe, initial=6, cache=cache) as stream:
+        assert stream.take(6)[-1] == 3.0
+        assert stream.launches == 0
+        assert stream[7] == 4.0
+    assert len(ZeroCache(tmp_path / "data").known(-4)) == 8
+    assert launches(tmp_path) == [6, 8]
+
+
+def test_views_share_one_buffer(tmp_path):
+    with ZeroStream(-3, fake_lcalc(tmp_path), initial=4) as stream:
+        head = stream.take(4)
+        assert head.dtype == np.float64 and not head.flags.writeable
+        assert np.shares_memory(head, stream.known)
+
+        # Growing the buffer leaves earlier views intact
+        stream.take(64)
+        assert head.tolist() == [0.5, 1.0, 1.5, 2.0]
+        assert len(stream.known) == 64
+
+
+def test_prefetch_thread_fills_streams_ahead(tmp_path):
+    exe = fake_lcalc(tmp_path)
+    config = SweepConfig(K=100, eps=1e-6, lcalc_path=exe, data_dir=tmp_path, log_path=tmp_path / "errors.log", prefetch=2)
+    ds = [-4, -3, 5, 8, 12]
+
+    seen = []
+    for d, stream, metrics in prefetched_streams(ds, config, series={}):
+        with stream:
+            assert stream.launches == 1 and stream.known[0] == 0.5      # Filled before it was handed over
+            assert metrics["lcalc_calls"] == 1
+        seen.append(d)
+    assert seen == ds
+
+
+def test_prefetch_stops_with_consumer(tmp_path):
+    config = SweepConfig(K=100, eps=1e-6, lcalc_path=fake_lcalc(tmp_path), data_dir=tmp_path, log_path=tmp_path / "errors.log", prefetch=1)
+    streams = prefetched_streams(list(range(-100, 0)), config, series={})
+    d, stream, _ = next(streams)
+    stream.close()
+    streams.close()         # Joins the thread; at most a couple of discriminants were fetched
+    assert len(launches(tmp_path)) <= 3